@@ -0,0 +1,123 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_COMMON_BLOCK_POOL_H_
+#define GCS_CORE_COMMON_BLOCK_POOL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include "common/config.h"
+
+namespace gcs::common
+{
+
+  /**
+   * @class BlockPool
+   * @brief Thread-safe free list of equally sized memory blocks.
+   *
+   * The block size is fixed by the first allocation. Freed blocks are kept
+   * for reuse, so a steady stream of allocations and frees only reaches the
+   * heap until the pool has grown to the peak number of live blocks.
+   * Requests of another size or of extended alignment bypass the pool.
+   */
+  class BlockPool
+  {
+  public:
+    /**
+     * @param max_free_blocks Freed blocks kept for reuse; further blocks are
+     * returned to the heap.
+     */
+    explicit BlockPool(
+        std::size_t max_free_blocks = kPacketPoolMaxFreeBlocks);
+
+    /**
+     * @brief Returns the free blocks to the heap. Blocks still in use must not
+     * be freed into the pool afterwards.
+     */
+    ~BlockPool();
+
+    BlockPool(const BlockPool &) = delete;
+    BlockPool &operator=(const BlockPool &) = delete;
+
+    /**
+     * @brief Allocates a block of at least size bytes.
+     * @throws std::bad_alloc if the heap is exhausted.
+     */
+    void *Allocate(std::size_t size, std::size_t alignment);
+
+    /**
+     * @brief Frees a block from Allocate() with the same size and alignment.
+     */
+    void Deallocate(void *block, std::size_t size,
+                    std::size_t alignment) noexcept;
+
+    /**
+     * @brief Number of freed blocks waiting for reuse.
+     */
+    std::size_t GetFreeCount() const;
+
+    /**
+     * @brief Number of blocks the pool has taken from the heap so far.
+     */
+    std::uint64_t GetHeapAllocationCount() const;
+
+  private:
+    struct FreeBlock
+    {
+      FreeBlock *next;
+    };
+
+    mutable std::mutex mutex_;
+    const std::size_t max_free_blocks_;
+    std::size_t block_size_ = 0;
+    FreeBlock *free_list_ = nullptr;
+    std::size_t free_count_ = 0;
+    std::uint64_t heap_allocations_ = 0;
+  };
+
+  /**
+   * @class PoolAllocator
+   * @brief Standard allocator that draws from a BlockPool, e.g. for
+   * std::allocate_shared, which places the object and its reference counts
+   * in a single block.
+   */
+  template <typename T>
+  class PoolAllocator
+  {
+  public:
+    using value_type = T;
+
+    explicit PoolAllocator(BlockPool &pool) noexcept : pool_(&pool) {}
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U> &other) noexcept
+        : pool_(other.GetPool()) {}
+
+    T *allocate(std::size_t n)
+    {
+      return static_cast<T *>(pool_->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *p, std::size_t n) noexcept
+    {
+      pool_->Deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    BlockPool *GetPool() const noexcept { return pool_; }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U> &other) const noexcept
+    {
+      return pool_ == other.GetPool();
+    }
+
+  private:
+    BlockPool *pool_;
+  };
+
+} // namespace gcs::common
+
+#endif // GCS_CORE_COMMON_BLOCK_POOL_H_
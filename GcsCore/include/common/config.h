@@ -6,8 +6,18 @@
 #define GCS_CORE_COMMON_CONFIG_H_
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 
+/**
+ * @def GCS_SIGNAL_STATS
+ * @brief When non-zero, Signal records per-listener call counts and callback
+ * latency. Defined to 0 (compiled out) unless set by the build.
+ */
+#ifndef GCS_SIGNAL_STATS
+#define GCS_SIGNAL_STATS 0
+#endif
+
 /**
  * @namespace gcs::common
  * @brief Common utilities and configuration constants.
@@ -44,6 +54,12 @@ namespace gcs::common
    */
   constexpr size_t kRawLogReplayChunkSize = 64;
 
+  /**
+   * @brief Number of frames read and emitted as one batch during parsed log
+   * replay.
+   */
+  constexpr size_t kParsedLogReplayBatchFrames = 64;
+
   /**
    * @brief Maximum allowed delay during replay in milliseconds.
    */
@@ -51,9 +67,93 @@ namespace gcs::common
 
   /**
    * @brief Minimum sleep time to control CPU usage within the replay loop.
+   * Frames due sooner than this are emitted without waiting.
    */
   constexpr std::chrono::milliseconds kReplayBusyLoopSleep(1);
 
+  /**
+   * @brief Timestamp gaps longer than this (e.g. a device restart) are
+   * replayed without waiting.
+   */
+  constexpr std::chrono::milliseconds kReplayMaxGap(5000);
+
+  /**
+   * @brief log2 of the frames summarized by one leaf of a log pyramid
+   * (.pyr). Smaller leaves allow finer zoom at the cost of a larger sidecar.
+   */
+  constexpr std::uint32_t kLogPyramidLeafShift = 6;
+
+  // --- Data Settings ---
+
+  /**
+   * @brief Frames per chunk of TelemetryColumnStore. Each chunk holds one
+   * aligned array per telemetry field.
+   */
+  constexpr std::size_t kTelemetryColumnChunkFrames = 16384;
+
+  /**
+   * @brief Frames per block of the telemetry codec. Blocks are the unit of
+   * random access; smaller blocks seek faster but compress slightly worse.
+   */
+  constexpr std::size_t kTelemetryCodecBlockFrames = 1024;
+
+  /**
+   * @brief Default number of frames kept by TelemetryHistory, rounded up to a
+   * power of two. About 80 seconds at 100 Hz.
+   */
+  constexpr std::size_t kTelemetryHistoryCapacity = 8192;
+
+  /**
+   * @brief Frames summarized by one leaf of the PlotDecimator min/max tree.
+   * Must be a power of two dividing kTelemetryColumnChunkFrames.
+   */
+  constexpr std::size_t kPlotDecimatorLeafFrames = 64;
+
+  /**
+   * @brief Compression of the t-digests kept by TelemetryStats. Higher keeps
+   * more centroids (about 2x this many) for more accurate percentiles.
+   */
+  constexpr double kTelemetryStatsCompression = 100.0;
+
+  /**
+   * @brief Default output period of TelemetryResampler (100 Hz).
+   */
+  constexpr std::chrono::microseconds kTelemetryResamplePeriod(10000);
+
+  /**
+   * @brief TelemetryResampler does not interpolate across input gaps longer
+   * than this; the output resumes at the first tick after the gap.
+   */
+  constexpr std::chrono::milliseconds kTelemetryResampleMaxGap(500);
+
+  // --- Event Settings ---
+
+  /**
+   * @brief Inline storage (in bytes) of a Delegate before it falls back to the
+   * heap. Fits a lambda capturing up to six pointers.
+   */
+  constexpr std::size_t kDelegateInlineSize = 6 * sizeof(void *);
+
+  /**
+   * @brief Listener priority of BinaryLogWriter connections, so that data is
+   * logged before other (e.g. UI) listeners run.
+   */
+  constexpr int kLoggerListenerPriority = 100;
+
+  // --- Packet Settings ---
+
+  /**
+   * @brief Freed blocks a packet pool keeps for reuse, per packet type.
+   * Blocks freed beyond this after a burst are returned to the heap.
+   */
+  constexpr std::size_t kPacketPoolMaxFreeBlocks = 4096;
+
+  /**
+   * @brief Packet IDs below this are resolved by PacketFactory through a
+   * flat table; larger or negative IDs fall back to a hash map.
+   */
+  constexpr std::size_t kPacketFactoryDenseIds = 256;
+
 } // namespace gcs::common
 
 #endif // GCS_CORE_COMMON_CONFIG_H_
\ No newline at end of file
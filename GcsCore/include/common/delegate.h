@@ -0,0 +1,267 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_COMMON_DELEGATE_H_
+#define GCS_CORE_COMMON_DELEGATE_H_
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "common/config.h"
+
+namespace gcs::common
+{
+
+  /**
+   * @brief Parameter type that passes a T without handing over ownership.
+   * Value types become const references; references are passed through.
+   */
+  template <typename T>
+  using ViewParam = std::conditional_t<std::is_reference_v<T>, T, const T &>;
+
+  /**
+   * @brief Parameter type that hands a T over to the callee. Value types
+   * become rvalue references; references are passed through.
+   */
+  template <typename T>
+  using SinkParam = std::conditional_t<std::is_reference_v<T>, T, T &&>;
+
+  template <typename Signature, std::size_t kInlineSize = kDelegateInlineSize>
+  class Delegate;
+
+  /**
+   * @class Delegate
+   * @brief Move-only type-erased callable with small-buffer storage.
+   * @tparam R Return type.
+   * @tparam A Argument types.
+   * @tparam kInlineSize Bytes of inline storage for the target.
+   *
+   * A replacement for std::function on event paths. Targets that fit into
+   * kInlineSize bytes and are nothrow-movable are stored inline, so
+   * constructing, moving and invoking the delegate never allocates. Larger
+   * targets are still accepted but are placed on the heap.
+   */
+  template <typename R, typename... A, std::size_t kInlineSize>
+  class Delegate<R(A...), kInlineSize>
+  {
+    static_assert(kInlineSize >= sizeof(void *),
+                  "Delegate storage must hold at least one pointer");
+
+    static constexpr std::size_t kAlignment = alignof(std::max_align_t);
+
+  public:
+    /**
+     * @brief True if a target of type F is stored without heap allocation.
+     */
+    template <typename F>
+    static constexpr bool kStoresInline =
+        sizeof(F) <= kInlineSize && alignof(F) <= kAlignment &&
+        std::is_nothrow_move_constructible_v<F>;
+
+    Delegate() noexcept = default;
+    Delegate(std::nullptr_t) noexcept {}
+
+    /**
+     * @brief Constructs a delegate wrapping the given callable.
+     * @param f Callable invocable with A... and returning something
+     * convertible to R.
+     */
+    template <typename F>
+      requires(!std::is_same_v<std::remove_cvref_t<F>, Delegate> &&
+               std::is_invocable_r_v<R, std::decay_t<F> &, A...>)
+    Delegate(F &&f)
+    {
+      using Target = std::decay_t<F>;
+      if constexpr (std::is_pointer_v<Target> ||
+                    std::is_member_pointer_v<Target>)
+      {
+        if (f == nullptr)
+          return;
+      }
+
+      if constexpr (kStoresInline<Target>)
+      {
+        ::new (static_cast<void *>(storage_)) Target(std::forward<F>(f));
+        ops_ = &kInlineOps<Target>;
+      }
+      else
+      {
+        *reinterpret_cast<Target **>(storage_) =
+            new Target(std::forward<F>(f));
+        ops_ = &kHeapOps<Target>;
+      }
+    }
+
+    ~Delegate() { Reset(); }
+
+    Delegate(const Delegate &) = delete;
+    Delegate &operator=(const Delegate &) = delete;
+
+    Delegate(Delegate &&other) noexcept { MoveFrom(other); }
+
+    Delegate &operator=(Delegate &&other) noexcept
+    {
+      if (this != &other)
+      {
+        Reset();
+        MoveFrom(other);
+      }
+      return *this;
+    }
+
+    Delegate &operator=(std::nullptr_t) noexcept
+    {
+      Reset();
+      return *this;
+    }
+
+    /**
+     * @brief Checks whether the delegate holds a target.
+     */
+    explicit operator bool() const noexcept { return ops_ != nullptr; }
+
+    /**
+     * @brief Invokes the target. The delegate must not be empty.
+     */
+    R operator()(A... args) const
+    {
+      return ops_->invoke(storage_, std::forward<A>(args)...);
+    }
+
+    /**
+     * @brief Invokes the target, handing over the arguments without an
+     * intermediate copy. The delegate must not be empty.
+     */
+    R InvokeSink(SinkParam<A>... args) const
+    {
+      return ops_->invoke(storage_, std::forward<SinkParam<A>>(args)...);
+    }
+
+    /**
+     * @brief Invokes the target without handing over the arguments. The
+     * delegate must not be empty.
+     *
+     * Targets that accept const references receive the caller's objects, so
+     * no copy is made. Targets that take a parameter by value receive a copy,
+     * and targets that require an rvalue receive a temporary copy.
+     */
+    R InvokeView(ViewParam<A>... args) const
+    {
+      return ops_->invoke_view(storage_, std::forward<ViewParam<A>>(args)...);
+    }
+
+    /**
+     * @brief Destroys the target, leaving the delegate empty.
+     */
+    void Reset() noexcept
+    {
+      if (ops_)
+      {
+        ops_->destroy(storage_);
+        ops_ = nullptr;
+      }
+    }
+
+  private:
+    struct Ops
+    {
+      R (*invoke)(void *storage, A &&...args);
+      R (*invoke_view)(void *storage, ViewParam<A>... args);
+      void (*move)(void *dst, void *src) noexcept;
+      void (*destroy)(void *storage) noexcept;
+    };
+
+    template <typename F>
+    static R Call(F &target, A &&...args)
+    {
+      if constexpr (std::is_void_v<R>)
+      {
+        std::invoke(target, std::forward<A>(args)...);
+      }
+      else
+      {
+        return std::invoke(target, std::forward<A>(args)...);
+      }
+    }
+
+    template <typename F>
+    static R CallView(F &target, ViewParam<A>... args)
+    {
+      if constexpr (std::is_invocable_r_v<R, F &, ViewParam<A>...>)
+      {
+        if constexpr (std::is_void_v<R>)
+        {
+          std::invoke(target, std::forward<ViewParam<A>>(args)...);
+        }
+        else
+        {
+          return std::invoke(target, std::forward<ViewParam<A>>(args)...);
+        }
+      }
+      else
+      {
+        static_assert((std::is_copy_constructible_v<std::remove_cvref_t<A>> && ...),
+                      "Targets that require rvalue arguments need copyable "
+                      "argument types");
+        return Call(target, static_cast<A>(std::forward<ViewParam<A>>(args))...);
+      }
+    }
+
+    template <typename F>
+    static constexpr Ops kInlineOps = {
+        [](void *storage, A &&...args) -> R
+        {
+          return Call(*std::launder(static_cast<F *>(storage)),
+                      std::forward<A>(args)...);
+        },
+        [](void *storage, ViewParam<A>... args) -> R
+        {
+          return CallView(*std::launder(static_cast<F *>(storage)),
+                          std::forward<ViewParam<A>>(args)...);
+        },
+        [](void *dst, void *src) noexcept
+        {
+          F *from = std::launder(static_cast<F *>(src));
+          ::new (dst) F(std::move(*from));
+          from->~F();
+        },
+        [](void *storage) noexcept
+        { std::launder(static_cast<F *>(storage))->~F(); }};
+
+    template <typename F>
+    static constexpr Ops kHeapOps = {
+        [](void *storage, A &&...args) -> R
+        {
+          return Call(**static_cast<F **>(storage), std::forward<A>(args)...);
+        },
+        [](void *storage, ViewParam<A>... args) -> R
+        {
+          return CallView(**static_cast<F **>(storage),
+                          std::forward<ViewParam<A>>(args)...);
+        },
+        [](void *dst, void *src) noexcept
+        { *static_cast<F **>(dst) = *static_cast<F **>(src); },
+        [](void *storage) noexcept
+        { delete *static_cast<F **>(storage); }};
+
+    void MoveFrom(Delegate &other) noexcept
+    {
+      if (other.ops_)
+      {
+        other.ops_->move(storage_, other.storage_);
+        ops_ = other.ops_;
+        other.ops_ = nullptr;
+      }
+    }
+
+    alignas(kAlignment) mutable std::byte storage_[kInlineSize];
+    const Ops *ops_ = nullptr;
+  };
+
+} // namespace gcs::common
+
+#endif // GCS_CORE_COMMON_DELEGATE_H_
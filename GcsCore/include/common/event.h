@@ -5,13 +5,33 @@
 #ifndef GCS_CORE_COMMON_EVENT_H_
 #define GCS_CORE_COMMON_EVENT_H_
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
+#include <exception>
+#include <iterator>
 #include <memory>
 #include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "common/config.h"
+#include "common/delegate.h"
+#include "common/executor.h"
+#include "common/latency_histogram.h"
+#include "common/listener_queue.h"
+#include "common/seqlock.h"
+
 namespace gcs::common
 {
 
@@ -20,7 +40,10 @@ namespace gcs::common
    * @brief An RAII object that manages an event connection.
    *
    * Automatically unsubscribes from the event when this object is destroyed.
-   * This ensures the safe management of the listener's lifecycle.
+   * Once the destructor returns the callback will not be called again. A
+   * call already running on another thread may still be finishing, except
+   * in the parallel dispatch modes, where the destructor waits for it unless
+   * it is invoked from within that call.
    */
   class ScopedConnection
   {
@@ -32,13 +55,13 @@ namespace gcs::common
      * @param unregister Function object containing the logic to unregister the
      * connection.
      */
-    explicit ScopedConnection(std::function<void()> unregister)
+    explicit ScopedConnection(Delegate<void()> unregister)
         : unregister_(std::move(unregister)) {}
 
     /**
      * @brief Destructor. Unsubscribes from the event.
      */
-    ~ScopedConnection()
+    virtual ~ScopedConnection()
     {
       if (unregister_)
       {
@@ -53,7 +76,7 @@ namespace gcs::common
     ScopedConnection &operator=(ScopedConnection &&) = default;
 
   private:
-    std::function<void()> unregister_;
+    Delegate<void()> unregister_;
   };
 
   /**
@@ -61,65 +84,1326 @@ namespace gcs::common
    */
   using SignalToken = std::unique_ptr<ScopedConnection>;
 
+  /**
+   * @class QueuedConnection
+   * @brief Connection token of an asynchronous listener.
+   *
+   * Besides unsubscribing on destruction, exposes the state of the
+   * listener's queue. Destroying the token discards pending events and waits
+   * for a running listener call to return. Can be stored in a SignalToken.
+   */
+  class QueuedConnection final : public ScopedConnection
+  {
+  public:
+    /**
+     * @brief Constructor.
+     * @param connection Token of the forwarding listener on the signal.
+     * @param queue Queue the forwarding listener pushes into.
+     */
+    QueuedConnection(SignalToken connection,
+                     std::shared_ptr<ListenerQueueBase> queue)
+        : ScopedConnection([connection = std::move(connection),
+                            queue]() mutable
+                           {
+                             // Stop producing before discarding the backlog.
+                             connection.reset();
+                             queue->Close(); }),
+          queue_(std::move(queue)) {}
+
+    /**
+     * @brief Number of events waiting to be delivered.
+     */
+    std::size_t GetQueueDepth() const { return queue_->GetDepth(); }
+
+    /**
+     * @brief Number of events discarded by the overflow policy.
+     */
+    std::uint64_t GetDroppedCount() const { return queue_->GetDroppedCount(); }
+
+    /**
+     * @brief Number of events delivered to the listener.
+     */
+    std::uint64_t GetDeliveredCount() const
+    {
+      return queue_->GetDeliveredCount();
+    }
+
+  private:
+    std::shared_ptr<const ListenerQueueBase> queue_;
+  };
+
+  /**
+   * @struct ListenerOptions
+   * @brief Optional per-listener settings passed to Signal::Connect.
+   */
+  struct ListenerOptions
+  {
+    std::string name; ///< Label reported in ListenerStats.
+    int priority = 0; ///< Higher priorities are invoked first.
+  };
+
+  /**
+   * @enum DispatchMode
+   * @brief How Signal::Invoke runs the registered listeners.
+   */
+  enum class DispatchMode
+  {
+    kSequential,      ///< One after another on the invoking thread.
+    kParallel,        ///< Concurrently on a pool; Invoke waits for all of them.
+    kParallelDetached ///< Concurrently on a pool; Invoke returns immediately.
+  };
+
+  namespace detail
+  {
+    /**
+     * @brief Listener call in progress on the current thread. Frames form a
+     * stack so a listener that disconnects itself is not waited for.
+     */
+    struct CallFrame
+    {
+      const void *listener;
+      const CallFrame *outer;
+    };
+
+    inline thread_local const CallFrame *tls_call_frames = nullptr;
+
+    /**
+     * @brief Owning type used to carry an argument past the end of a
+     * detached Invoke. Views are copied into the container they view.
+     */
+    template <typename T>
+    struct OwnedCopy
+    {
+      using type = T;
+    };
+
+    template <typename T, std::size_t Extent>
+    struct OwnedCopy<std::span<T, Extent>>
+    {
+      using type = std::vector<std::remove_cv_t<T>>;
+    };
+
+    template <typename CharT, typename Traits>
+    struct OwnedCopy<std::basic_string_view<CharT, Traits>>
+    {
+      using type = std::basic_string<CharT, Traits>;
+    };
+
+    template <typename T>
+    using OwnedCopyT = typename OwnedCopy<std::decay_t<T>>::type;
+
+    template <typename T>
+    OwnedCopyT<T> MakeOwnedCopy(T &&value)
+    {
+      if constexpr (std::is_same_v<OwnedCopyT<T>, std::decay_t<T>>)
+      {
+        return std::forward<T>(value);
+      }
+      else
+      {
+        return OwnedCopyT<T>(value.begin(), value.end());
+      }
+    }
+  } // namespace detail
+
+  /**
+   * @struct ListenerStats
+   * @brief Runtime statistics of one connected listener.
+   *
+   * Counters are only collected when the library is built with
+   * GCS_SIGNAL_STATS; otherwise they stay zero.
+   */
+  struct ListenerStats
+  {
+    std::string name;                         ///< Name from ListenerOptions.
+    int priority = 0;                         ///< Priority from ListenerOptions.
+    std::uint64_t call_count = 0;             ///< Number of calls.
+    std::chrono::nanoseconds total_time{0};   ///< Cumulative time in callback.
+    LatencyHistogram::Counts latency_counts{}; ///< Callback duration histogram.
+  };
+
   /**
    * @class Signal
    * @brief Multi-listener event publisher (Observer Pattern).
    * @tparam Args Argument types to be passed when the event occurs.
    *
    * Allows multiple callback functions to be registered and invoked in a
-   * thread-safe manner.
+   * thread-safe manner. Listeners live in a flat slot table addressed by
+   * generation-tagged handles, so disconnecting is O(1). Invoke walks a
+   * contiguous snapshot of listener pointers ordered by priority, without
+   * taking a lock or allocating. Connect appends to the published snapshot
+   * in place when the ordering allows and otherwise publishes a new one;
+   * disconnected entries are skipped and compacted away once they make up
+   * half of the snapshot. Readers register in one of two epoch counters;
+   * the next Connect or Disconnect reclaims replaced snapshots once the
+   * epoch they were retired in has drained, so reclamation keeps up even
+   * when Invoke never goes idle, and readers only ever touch their counter.
+   *
+   * Listeners run sequentially by default. SetDispatchMode fans them out to
+   * a ThreadPoolExecutor instead; priorities then only decide the order in
+   * which the calls are started.
    */
   template <typename... Args>
   class Signal
   {
   public:
-    using Callback = std::function<void(Args...)>;
+    using Callback = Delegate<void(Args...)>;
+
+    Signal() = default;
+
+    /**
+     * @brief Destructor. Waits for detached calls, then releases the published
+     * snapshot.
+     *
+     * All connection tokens must be released before the signal is destroyed.
+     */
+    ~Signal()
+    {
+      {
+        std::unique_lock<std::mutex> lock(detached_mutex_);
+        detached_idle_.wait(lock, [this]()
+                            { return detached_batches_ == 0; });
+      }
+      delete snapshot_.load(std::memory_order_acquire);
+    }
+
+    Signal(const Signal &) = delete;
+    Signal &operator=(const Signal &) = delete;
 
     /**
      * @brief Registers an event listener (callback).
      * @param cb Callback function to register.
+     * @param options Listener name, priority and other optional settings.
      * @return Connection token. Subscription is maintained as long as this token
      * is kept.
      */
-    [[nodiscard]] std::unique_ptr<ScopedConnection> Connect(Callback cb)
+    [[nodiscard]] std::unique_ptr<ScopedConnection> Connect(
+        Callback cb, ListenerOptions options = {})
     {
-      std::lock_guard<std::mutex> lock(mutex_);
-      std::uint64_t id = next_id_++;
-      callbacks_[id] = std::move(cb);
+      Retired retired;
+      std::uint64_t handle = 0;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto listener = std::make_unique<Listener>();
+        listener->name = std::move(options.name);
+        listener->priority = options.priority;
+        listener->callback = std::move(cb);
+
+        std::uint32_t index = 0;
+        if (!free_slots_.empty())
+        {
+          index = free_slots_.back();
+          free_slots_.pop_back();
+        }
+        else
+        {
+          index = static_cast<std::uint32_t>(slots_.size());
+          slots_.emplace_back();
+        }
+
+        Slot &slot = slots_[index];
+        slot.listener = std::move(listener);
+        handle = (static_cast<std::uint64_t>(index) << 32) | slot.generation;
+        ++live_count_;
+        InsertLocked(slot.listener.get(), retired);
+      }
 
       // Unregister automatically when the returned object is destroyed.
-      return std::make_unique<ScopedConnection>([this, id]()
-                                                {
+      auto unregister = [this, handle]()
+      { Disconnect(handle); };
+      static_assert(Delegate<void()>::kStoresInline<decltype(unregister)>);
+      return std::make_unique<ScopedConnection>(std::move(unregister));
+    }
+
+    /**
+     * @brief Registers a listener that runs asynchronously on an executor.
+     * @param cb Callback function to register.
+     * @param options Executor, queue capacity and overflow policy.
+     * @param listener_options Listener name and other optional settings. The
+     * statistics cover the cost of enqueueing on the producer side.
+     * @return Connection token exposing queue depth and drop counters.
+     * @throws std::invalid_argument if options.executor is null.
+     *
+     * Invoke copies the arguments into the listener's bounded queue instead
+     * of calling it, so a slow listener does not stall the producer (unless
+     * the overflow policy is OverflowPolicy::kBlock).
+     */
+    [[nodiscard]] std::unique_ptr<QueuedConnection> ConnectQueued(
+        Callback cb, QueueOptions options, ListenerOptions listener_options = {})
+    {
+      if (!options.executor)
+      {
+        throw std::invalid_argument("Queued connection requires an executor");
+      }
+
+      auto queue = std::make_shared<ListenerQueue<Args...>>(std::move(cb),
+                                                            std::move(options));
+      SignalToken connection = Connect([queue](ViewParam<Args>... args)
+                                       { queue->Push(std::forward<ViewParam<Args>>(args)...); },
+                                       std::move(listener_options));
+      return std::make_unique<QueuedConnection>(std::move(connection),
+                                                std::move(queue));
+    }
+
+    /**
+     * @brief Selects how Invoke runs the listeners.
+     * @param mode Dispatch mode.
+     * @param pool Pool running the listeners in the parallel modes.
+     * @throws std::invalid_argument if a parallel mode is requested without a
+     * pool, or kParallelDetached for arguments that cannot be copied.
+     *
+     * In DispatchMode::kParallel the invoking thread and the pool take
+     * listeners from the same batch until none is left, then Invoke waits
+     * for the calls still running; the first exception thrown by a listener
+     * is rethrown by Invoke. In DispatchMode::kParallelDetached the arguments
+     * are copied (views such as std::span are copied into owning containers)
+     * and Invoke returns at once; exceptions thrown by listeners are
+     * discarded. In both parallel modes no callback runs after its
+     * connection token has been destroyed. Calls started in
+     * DispatchMode::kSequential are not tracked; see ScopedConnection.
+     */
+    void SetDispatchMode(DispatchMode mode,
+                         std::shared_ptr<ThreadPoolExecutor> pool = nullptr)
+    {
+      if (mode != DispatchMode::kSequential && !pool)
+      {
+        throw std::invalid_argument("Parallel dispatch requires a thread pool");
+      }
+      if (mode == DispatchMode::kParallelDetached && !kCanDetach)
+      {
+        throw std::invalid_argument(
+            "Detached dispatch requires copyable arguments");
+      }
+
+      Retired retired;
       std::lock_guard<std::mutex> lock(mutex_);
-      callbacks_.erase(id); });
+      mode_ = mode;
+      pool_ = mode == DispatchMode::kSequential ? nullptr : std::move(pool);
+      RebuildLocked(nullptr, retired);
     }
 
     /**
      * @brief Invokes the event, calling all registered callbacks.
-     * @param args Arguments to pass to the callbacks.
+     * @param args Arguments to pass to the callbacks. Listeners that take
+     * them by const reference see the caller's objects, so nothing is copied
+     * and no reference count is touched.
+     */
+    void Invoke(ViewParam<Args>... args)
+    {
+      Dispatch<false>(std::forward<ViewParam<Args>>(args)...);
+    }
+
+    /**
+     * @brief Invokes the event with arguments handed over by the caller.
+     * @param args Arguments to pass to the callbacks. Every listener but the
+     * last sees them by const reference; in DispatchMode::kSequential the
+     * last listener receives them by move.
      */
-    void Invoke(Args... args)
+    void Invoke(SinkParam<Args>... args)
+      requires((!std::is_reference_v<Args>) || ...)
+    {
+      Dispatch<true>(std::forward<SinkParam<Args>>(args)...);
+    }
+
+    /**
+     * @brief Invokes the event once per element of a range.
+     * @param items Values passed to the callbacks, one element per call.
+     *
+     * Equivalent to calling Invoke for every element, but the listener
+     * snapshot is acquired only once for the whole range.
+     */
+    template <typename Range>
+      requires(sizeof...(Args) == 1)
+    void InvokeForEach(const Range &items)
+    {
+      InvokeGuard guard(*this);
+      const Snapshot *snapshot = snapshot_.load(std::memory_order_seq_cst);
+      if (!snapshot)
+        return;
+
+      const Listener *const *entries = snapshot->entries.get();
+      std::size_t count = snapshot->size.load(std::memory_order_acquire);
+      if (count == 0)
+        return;
+
+      switch (snapshot->mode)
+      {
+      case DispatchMode::kSequential:
+        for (const auto &item : items)
+        {
+          for (std::size_t i = 0; i < count; ++i)
+          {
+            CallIfConnected(*entries[i], item);
+          }
+        }
+        break;
+      case DispatchMode::kParallel:
+        // Each listener walks the whole range on one thread, so it still
+        // sees the items in order.
+        RunParallel(*snapshot, [&](const Listener &listener)
+                    {
+                      for (const auto &item : items)
+                      {
+                        CallTracked(listener, item);
+                      }
+                    });
+        break;
+      case DispatchMode::kParallelDetached:
+        if constexpr (kCanDetach)
+        {
+          using Arg = std::decay_t<std::tuple_element_t<0, std::tuple<Args...>>>;
+          std::vector<detail::OwnedCopyT<Arg>> values;
+          for (const auto &item : items)
+          {
+            values.push_back(
+                detail::MakeOwnedCopy(static_cast<const Arg &>(item)));
+          }
+          PostDetached(*snapshot, std::move(values),
+                       [](const Listener &listener, const auto &copies)
+                       {
+                         for (const auto &copy : copies)
+                         {
+                           CallTracked(listener, copy);
+                         }
+                       });
+        }
+        break;
+      }
+    }
+
+    /**
+     * @brief Returns statistics for every connected listener.
+     *
+     * Counters are zero unless the library is built with GCS_SIGNAL_STATS.
+     */
+    std::vector<ListenerStats> GetListenerStats() const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::vector<ListenerStats> stats;
+      stats.reserve(live_count_);
+      for (const Slot &slot : slots_)
+      {
+        if (!slot.listener)
+          continue;
+
+        const Listener &listener = *slot.listener;
+        ListenerStats entry;
+        entry.name = listener.name;
+        entry.priority = listener.priority;
+#if GCS_SIGNAL_STATS
+        entry.call_count = listener.call_count.load(std::memory_order_relaxed);
+        entry.total_time = std::chrono::nanoseconds(
+            listener.total_ns.load(std::memory_order_relaxed));
+        entry.latency_counts = listener.latency.GetCounts();
+#endif
+        stats.push_back(std::move(entry));
+      }
+      return stats;
+    }
+
+  private:
+    // Snapshots are compacted once at least this many entries are dead and
+    // the dead entries make up half of the snapshot.
+    static constexpr std::size_t kMinCompactDead = 8;
+    static constexpr std::size_t kMinSnapshotCapacity = 4;
+
+    // Whether the arguments can outlive Invoke for DispatchMode::kParallelDetached.
+    static constexpr bool kCanDetach =
+        (std::is_copy_constructible_v<detail::OwnedCopyT<Args>> && ...) &&
+        std::is_invocable_v<const Callback &,
+                            const detail::OwnedCopyT<Args> &...>;
+
+    struct Listener
+    {
+      std::string name;
+      int priority = 0;
+      Callback callback;
+      std::atomic<bool> connected = true;
+      // Calls running in a parallel batch; sequential calls are not counted.
+      mutable std::atomic<std::uint32_t> in_flight = 0;
+#if GCS_SIGNAL_STATS
+      mutable std::atomic<std::uint64_t> call_count = 0;
+      mutable std::atomic<std::uint64_t> total_ns = 0;
+      mutable LatencyHistogram latency;
+#endif
+    };
+
+    /**
+     * @brief Writer-side table entry. The generation is bumped on every
+     * disconnect so stale handles are ignored.
+     */
+    struct Slot
+    {
+      std::uint32_t generation = 0;
+      std::unique_ptr<Listener> listener;
+    };
+
+    /**
+     * @brief Priority-ordered array of listener pointers read by Invoke.
+     *
+     * Entries below size are immutable; the writer may fill the free tail
+     * and publish it by advancing size.
+     */
+    struct Snapshot
+    {
+      explicit Snapshot(std::size_t capacity)
+          : entries(std::make_unique<const Listener *[]>(capacity)),
+            capacity(capacity) {}
+
+      std::unique_ptr<const Listener *[]> entries;
+      std::size_t capacity;
+      std::atomic<std::size_t> size = 0;
+      DispatchMode mode = DispatchMode::kSequential;
+      std::shared_ptr<ThreadPoolExecutor> pool;
+    };
+
+    /**
+     * @brief Objects unlinked from the published snapshot but possibly still
+     * visible to an in-flight Invoke.
+     */
+    struct Retired
+    {
+      std::vector<std::unique_ptr<const Snapshot>> snapshots;
+      std::vector<std::unique_ptr<Listener>> listeners;
+
+      bool empty() const { return snapshots.empty() && listeners.empty(); }
+
+      // Takes over other's objects. Swaps the buffers when this is empty,
+      // which is the common case.
+      void Splice(Retired &other)
+      {
+        if (empty())
+        {
+          snapshots.swap(other.snapshots);
+          listeners.swap(other.listeners);
+          return;
+        }
+        std::move(other.snapshots.begin(), other.snapshots.end(),
+                  std::back_inserter(snapshots));
+        std::move(other.listeners.begin(), other.listeners.end(),
+                  std::back_inserter(listeners));
+        other.snapshots.clear();
+        other.listeners.clear();
+      }
+    };
+
+    /**
+     * @brief Registers an Invoke in the current read epoch for the lifetime
+     * of the guard.
+     */
+    class InvokeGuard
+    {
+    public:
+      explicit InvokeGuard(Signal &signal)
+          : signal_(signal), epoch_slot_(signal.EnterRead()) {}
+
+      ~InvokeGuard() { signal_.LeaveRead(epoch_slot_); }
+
+      InvokeGuard(const InvokeGuard &) = delete;
+      InvokeGuard &operator=(const InvokeGuard &) = delete;
+
+    private:
+      Signal &signal_;
+      std::size_t epoch_slot_;
+    };
+
+    /**
+     * @brief Counts a parallel call as in flight on the listener so
+     * Disconnect can wait for it.
+     */
+    class ActiveCall
+    {
+    public:
+      explicit ActiveCall(const Listener &listener)
+          : listener_(listener), frame_{&listener, detail::tls_call_frames}
+      {
+        listener_.in_flight.fetch_add(1, std::memory_order_seq_cst);
+        detail::tls_call_frames = &frame_;
+      }
+
+      ~ActiveCall()
+      {
+        detail::tls_call_frames = frame_.outer;
+        listener_.in_flight.fetch_sub(1, std::memory_order_seq_cst);
+        // Pairs with Disconnect, which clears the flag before waiting.
+        if (!listener_.connected.load(std::memory_order_seq_cst))
+        {
+          listener_.in_flight.notify_all();
+        }
+      }
+
+      ActiveCall(const ActiveCall &) = delete;
+      ActiveCall &operator=(const ActiveCall &) = delete;
+
+    private:
+      const Listener &listener_;
+      detail::CallFrame frame_;
+    };
+
+    /**
+     * @brief Listeners of one parallel Invoke and their completion state.
+     *
+     * The invoking thread and the pool tasks claim listeners by index. Only
+     * the invoker and tasks holding a claim use the listeners and fn; a task
+     * that runs after every listener has been claimed touches nothing but
+     * this object, which it keeps alive.
+     */
+    template <typename Fn>
+    struct ParallelJoin
+    {
+      ParallelJoin(const Listener *const *entries, std::size_t count,
+                   const Fn &fn)
+          : entries(entries), count(count), fn(fn) {}
+
+      // Runs unclaimed listeners until none is left.
+      void Drain() noexcept
+      {
+        std::size_t index;
+        while ((index = next.fetch_add(1, std::memory_order_relaxed)) < count)
+        {
+          try
+          {
+            fn(*entries[index]);
+          }
+          catch (...)
+          {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error)
+            {
+              error = std::current_exception();
+            }
+          }
+
+          std::lock_guard<std::mutex> lock(mutex);
+          if (++finished == count)
+          {
+            done.notify_all();
+          }
+        }
+      }
+
+      const Listener *const *entries;
+      const std::size_t count;
+      const Fn &fn;
+      std::atomic<std::size_t> next = 0;
+
+      std::mutex mutex;
+      std::condition_variable done;
+      std::size_t finished = 0;
+      std::exception_ptr error;
+    };
+
+    /**
+     * @brief Arguments of a detached Invoke, shared by its tasks. Keeps the
+     * snapshot's listeners alive until the last task has run.
+     */
+    template <typename Values, typename Fn>
+    struct DetachedBatch
+    {
+      DetachedBatch(Signal &signal, Values values, Fn fn)
+          : signal(signal), values(std::move(values)), fn(std::move(fn))
+      {
+        {
+          std::lock_guard<std::mutex> lock(signal.detached_mutex_);
+          ++signal.detached_batches_;
+        }
+        epoch_slot = signal.EnterRead();
+      }
+
+      ~DetachedBatch()
+      {
+        signal.LeaveRead(epoch_slot);
+        // Last access to the signal; its destructor may proceed once the
+        // lock is released.
+        std::lock_guard<std::mutex> lock(signal.detached_mutex_);
+        if (--signal.detached_batches_ == 0)
+        {
+          signal.detached_idle_.notify_all();
+        }
+      }
+
+      DetachedBatch(const DetachedBatch &) = delete;
+      DetachedBatch &operator=(const DetachedBatch &) = delete;
+
+      Signal &signal;
+      const Values values;
+      const Fn fn;
+      std::size_t epoch_slot = 0;
+    };
+
+    template <bool kSink = false, typename... CallArgs>
+    static void CallIfConnected(const Listener &listener, CallArgs &&...args)
+    {
+      if (listener.connected.load(std::memory_order_acquire))
+      {
+        Call<kSink>(listener, std::forward<CallArgs>(args)...);
+      }
+    }
+
+    // Calls the listener as part of a parallel batch, so Disconnect can wait
+    // for the call to return.
+    template <typename... CallArgs>
+    static void CallTracked(const Listener &listener, CallArgs &&...args)
+    {
+      // Publishing the call before checking the flag pairs with Disconnect,
+      // which clears the flag before waiting for in-flight calls.
+      ActiveCall active(listener);
+      if (listener.connected.load(std::memory_order_seq_cst))
+      {
+        Call<false>(listener, std::forward<CallArgs>(args)...);
+      }
+    }
+
+    // Runs the listeners. With kOwnsArgs the arguments may be moved into
+    // the last listener of a sequential signal.
+    template <bool kOwnsArgs, typename... CallArgs>
+    void Dispatch(CallArgs &&...args)
+    {
+      InvokeGuard guard(*this);
+      const Snapshot *snapshot = snapshot_.load(std::memory_order_seq_cst);
+      if (!snapshot)
+        return;
+
+      switch (snapshot->mode)
+      {
+      case DispatchMode::kSequential:
+      {
+        const Listener *const *entries = snapshot->entries.get();
+        std::size_t count = snapshot->size.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          if constexpr (kOwnsArgs)
+          {
+            if (i + 1 == count)
+            {
+              CallIfConnected<true>(*entries[i], std::forward<CallArgs>(args)...);
+              break;
+            }
+          }
+          CallIfConnected(*entries[i], args...);
+        }
+        break;
+      }
+      case DispatchMode::kParallel:
+        RunParallel(*snapshot, [&](const Listener &listener)
+                    { CallTracked(listener, args...); });
+        break;
+      case DispatchMode::kParallelDetached:
+        if constexpr (kCanDetach)
+        {
+          PostDetached(*snapshot,
+                       std::tuple<detail::OwnedCopyT<Args>...>(
+                           detail::MakeOwnedCopy(std::forward<CallArgs>(args))...),
+                       [](const Listener &listener, const auto &values)
+                       {
+                         std::apply([&](const auto &...copies)
+                                    { CallTracked(listener, copies...); },
+                                    values);
+                       });
+        }
+        break;
+      }
+    }
+
+    template <typename Fn>
+    static void RunParallel(const Snapshot &snapshot, const Fn &fn)
+    {
+      const Listener *const *entries = snapshot.entries.get();
+      std::size_t count = snapshot.size.load(std::memory_order_acquire);
+
+      std::size_t live = 0;
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        if (entries[i]->connected.load(std::memory_order_relaxed))
+        {
+          ++live;
+        }
+      }
+      if (live == 0)
+        return;
+
+      // The invoking thread takes part, so one helper fewer than listeners
+      // is enough. Helpers only ever run listeners of this batch.
+      auto join = std::make_shared<ParallelJoin<Fn>>(entries, count, fn);
+      ThreadPoolExecutor &pool = *snapshot.pool;
+      std::size_t helpers = std::min(live - 1, pool.GetThreadCount());
+      for (std::size_t i = 0; i < helpers; ++i)
+      {
+        pool.Post([join]()
+                  { join->Drain(); });
+      }
+
+      join->Drain();
+
+      // Every listener is claimed; wait only for calls still running.
+      std::unique_lock<std::mutex> lock(join->mutex);
+      join->done.wait(lock, [&join]()
+                      { return join->finished == join->count; });
+      if (join->error)
+      {
+        std::rethrow_exception(join->error);
+      }
+    }
+
+    template <typename Values, typename Fn>
+    void PostDetached(const Snapshot &snapshot, Values values, Fn fn)
+    {
+      const Listener *const *entries = snapshot.entries.get();
+      std::size_t count = snapshot.size.load(std::memory_order_acquire);
+
+      auto batch = std::make_shared<DetachedBatch<Values, Fn>>(
+          *this, std::move(values), std::move(fn));
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        const Listener *listener = entries[i];
+        if (!listener->connected.load(std::memory_order_relaxed))
+          continue;
+
+        snapshot.pool->Post([batch, listener]()
+                            {
+                              try
+                              {
+                                batch->fn(*listener, batch->values);
+                              }
+                              catch (...)
+                              {
+                                // Nobody is left to report to.
+                              } });
+      }
+    }
+
+    // Waits until no other thread is running the listener's callback in a
+    // parallel batch.
+    static void WaitForCalls(const Listener &listener)
+    {
+      std::uint32_t own_calls = 0;
+      for (const detail::CallFrame *frame = detail::tls_call_frames; frame;
+           frame = frame->outer)
+      {
+        if (frame->listener == &listener)
+        {
+          ++own_calls;
+        }
+      }
+
+      // ActiveCall notifies on every return once the listener is
+      // disconnected.
+      std::uint32_t in_flight;
+      while ((in_flight = listener.in_flight.load(std::memory_order_seq_cst)) >
+             own_calls)
+      {
+        listener.in_flight.wait(in_flight, std::memory_order_seq_cst);
+      }
+    }
+
+    // Calls the listener with views of the arguments, or hands them over if
+    // kSink is set.
+    template <bool kSink, typename... CallArgs>
+    static void Call(const Listener &listener, CallArgs &&...args)
+    {
+#if GCS_SIGNAL_STATS
+      auto start = std::chrono::steady_clock::now();
+      Forward<kSink>(listener.callback, std::forward<CallArgs>(args)...);
+      auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start);
+      listener.call_count.fetch_add(1, std::memory_order_relaxed);
+      listener.total_ns.fetch_add(static_cast<std::uint64_t>(elapsed.count()),
+                                  std::memory_order_relaxed);
+      listener.latency.Record(elapsed);
+#else
+      Forward<kSink>(listener.callback, std::forward<CallArgs>(args)...);
+#endif
+    }
+
+    template <bool kSink, typename... CallArgs>
+    static void Forward(const Callback &callback, CallArgs &&...args)
+    {
+      if constexpr (kSink)
+      {
+        callback.InvokeSink(std::forward<CallArgs>(args)...);
+      }
+      else
+      {
+        callback.InvokeView(std::forward<CallArgs>(args)...);
+      }
+    }
+
+    void Disconnect(std::uint64_t handle)
     {
-      std::vector<Callback> safe_callbacks;
+      Retired retired;
+      // Keeps the listener from being reclaimed while its calls drain.
+      InvokeGuard keep_alive(*this);
+      const Listener *listener = nullptr;
       {
         std::lock_guard<std::mutex> lock(mutex_);
-        safe_callbacks.reserve(callbacks_.size());
-        for (const auto &[id, cb] : callbacks_)
+        auto index = static_cast<std::size_t>(handle >> 32);
+        auto generation = static_cast<std::uint32_t>(handle);
+        if (index >= slots_.size() || slots_[index].generation != generation ||
+            !slots_[index].listener)
+          return;
+
+        Slot &slot = slots_[index];
+        slot.listener->connected.store(false, std::memory_order_seq_cst);
+        listener = slot.listener.get();
+
+        // The published snapshot still points at the listener; keep it alive
+        // until the snapshot is compacted and reclaimed.
+        dead_listeners_.push_back(std::move(slot.listener));
+        ++slot.generation;
+        free_slots_.push_back(static_cast<std::uint32_t>(index));
+        --live_count_;
+
+        if (dead_listeners_.size() >= kMinCompactDead &&
+            dead_listeners_.size() * 2 >= live_count_ + dead_listeners_.size())
+        {
+          RebuildLocked(nullptr, retired);
+        }
+        else
         {
-          safe_callbacks.push_back(cb);
+          ReclaimLocked(retired);
         }
       }
+      WaitForCalls(*listener);
+    }
 
-      for (const auto &cb : safe_callbacks)
+    // Adds a listener to the published snapshot. Must be called with mutex_
+    // held. Objects that became reclaimable are moved into |out| so they are
+    // destroyed after the lock is released.
+    void InsertLocked(const Listener *listener, Retired &out)
+    {
+      Snapshot *snapshot = snapshot_.load(std::memory_order_relaxed);
+      if (snapshot)
       {
-        cb(args...);
+        std::size_t size = snapshot->size.load(std::memory_order_relaxed);
+        if (size < snapshot->capacity &&
+            (size == 0 ||
+             snapshot->entries[size - 1]->priority >= listener->priority))
+        {
+          snapshot->entries[size] = listener;
+          snapshot->size.store(size + 1, std::memory_order_release);
+          ReclaimLocked(out);
+          return;
+        }
       }
+      RebuildLocked(listener, out);
+    }
+
+    // Publishes a compacted snapshot of the live listeners, plus |added| in
+    // priority order if not null. Must be called with mutex_ held.
+    void RebuildLocked(const Listener *added, Retired &out)
+    {
+      Snapshot *old = snapshot_.load(std::memory_order_relaxed);
+      std::size_t capacity = std::max(kMinSnapshotCapacity, live_count_ * 2);
+      auto snapshot = std::make_unique<Snapshot>(capacity);
+
+      std::size_t size = 0;
+      if (old)
+      {
+        std::size_t old_size = old->size.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < old_size; ++i)
+        {
+          const Listener *entry = old->entries[i];
+          if (!entry->connected.load(std::memory_order_relaxed))
+            continue;
+          if (added && added->priority > entry->priority)
+          {
+            snapshot->entries[size++] = added;
+            added = nullptr;
+          }
+          snapshot->entries[size++] = entry;
+        }
+      }
+      if (added)
+      {
+        snapshot->entries[size++] = added;
+      }
+      snapshot->size.store(size, std::memory_order_relaxed);
+      snapshot->mode = mode_;
+      snapshot->pool = pool_;
+
+      snapshot_.store(snapshot.release(), std::memory_order_seq_cst);
+      if (old)
+      {
+        retired_.snapshots.emplace_back(old);
+      }
+      for (auto &listener : dead_listeners_)
+      {
+        retired_.listeners.push_back(std::move(listener));
+      }
+      dead_listeners_.clear();
+      ReclaimLocked(out);
+    }
+
+    // Registers a reader in the current epoch and returns its counter.
+    std::size_t EnterRead()
+    {
+      while (true)
+      {
+        std::uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+        std::size_t slot = static_cast<std::size_t>(epoch & 1);
+        readers_[slot].fetch_add(1, std::memory_order_seq_cst);
+        // A reader that raced with an epoch flip must not join the counter
+        // the writer is draining; it retries in the new epoch.
+        if (epoch_.load(std::memory_order_seq_cst) == epoch)
+          return slot;
+        LeaveRead(slot);
+      }
+    }
+
+    // Readers never lock or free; the next Connect or Disconnect reclaims
+    // what the epoch they leave was holding back.
+    void LeaveRead(std::size_t slot)
+    {
+      readers_[slot].fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    // Frees retired objects no reader can reach any more. Objects retired
+    // since the last epoch flip wait in retired_; a flip moves them to
+    // draining_, which is freed by the first writer to find the readers of
+    // the previous epoch gone. Must be called with mutex_ held; reclaimed
+    // objects are moved into |out| so they are destroyed after the lock is
+    // released.
+    void ReclaimLocked(Retired &out)
+    {
+      if (!draining_.empty())
+      {
+        std::uint64_t epoch = epoch_.load(std::memory_order_relaxed);
+        if (readers_[(epoch - 1) & 1].load(std::memory_order_seq_cst) != 0)
+          return;
+        out.Splice(draining_);
+      }
+
+      if (!retired_.empty())
+      {
+        // Readers that enter after the flip can only observe the current
+        // snapshot, so the retired objects are unreachable once the readers
+        // of the old epoch have left.
+        std::uint64_t old_epoch = epoch_.fetch_add(1, std::memory_order_seq_cst);
+        draining_.Splice(retired_);
+        if (readers_[old_epoch & 1].load(std::memory_order_seq_cst) == 0)
+        {
+          out.Splice(draining_);
+        }
+      }
+    }
+
+    // Writer-side state, guarded by mutex_.
+    std::vector<Slot> slots_;
+    std::vector<std::uint32_t> free_slots_;
+    std::vector<std::unique_ptr<Listener>> dead_listeners_;
+    std::size_t live_count_ = 0;
+    Retired retired_;
+    Retired draining_;
+    DispatchMode mode_ = DispatchMode::kSequential;
+    std::shared_ptr<ThreadPoolExecutor> pool_;
+    mutable std::mutex mutex_;
+
+    // Reader-side state.
+    std::atomic<Snapshot *> snapshot_ = nullptr;
+    std::atomic<std::uint64_t> epoch_ = 0;
+    std::atomic<std::size_t> readers_[2] = {0, 0};
+
+    // Detached batches still referencing the signal, guarded by
+    // detached_mutex_.
+    std::size_t detached_batches_ = 0;
+    std::mutex detached_mutex_;
+    std::condition_variable detached_idle_;
+  };
+
+  /**
+   * @class BatchSignal
+   * @brief Event publisher that delivers runs of values in a single call.
+   * @tparam T Element type of the run.
+   *
+   * Producers emit either one value (Invoke) or a contiguous run of values
+   * (InvokeBatch). Batch listeners receive the whole run as a
+   * std::span<const T>; per-item listeners registered with Connect keep
+   * receiving one value per call and are notified after the batch listeners.
+   */
+  template <typename T>
+  class BatchSignal
+  {
+  public:
+    using Callback = typename Signal<const T &>::Callback;
+    using BatchCallback = typename Signal<std::span<const T>>::Callback;
+
+    /**
+     * @brief Registers a listener that receives one value per call.
+     * @param cb Callback function to register.
+     * @param options Listener name and other optional settings.
+     * @return Connection token.
+     */
+    [[nodiscard]] SignalToken Connect(Callback cb, ListenerOptions options = {})
+    {
+      return items_.Connect(std::move(cb), std::move(options));
+    }
+
+    /**
+     * @brief Registers a per-item listener that runs on an executor.
+     * @param cb Callback function to register.
+     * @param options Executor, queue capacity and overflow policy.
+     * @param listener_options Listener name and other optional settings.
+     * @return Connection token exposing queue depth and drop counters.
+     * @see Signal::ConnectQueued
+     */
+    [[nodiscard]] std::unique_ptr<QueuedConnection> ConnectQueued(
+        Callback cb, QueueOptions options, ListenerOptions listener_options = {})
+    {
+      return items_.ConnectQueued(std::move(cb), std::move(options),
+                                  std::move(listener_options));
+    }
+
+    /**
+     * @brief Registers a listener that receives whole runs of values.
+     * @param cb Callback function to register. The span is only valid for the
+     * duration of the call.
+     * @param options Listener name and other optional settings.
+     * @return Connection token.
+     */
+    [[nodiscard]] SignalToken ConnectBatch(BatchCallback cb,
+                                           ListenerOptions options = {})
+    {
+      return batches_.Connect(std::move(cb), std::move(options));
+    }
+
+    /**
+     * @brief Selects how batch and per-item listeners are run.
+     * @see Signal::SetDispatchMode
+     */
+    void SetDispatchMode(DispatchMode mode,
+                         std::shared_ptr<ThreadPoolExecutor> pool = nullptr)
+    {
+      batches_.SetDispatchMode(mode, pool);
+      items_.SetDispatchMode(mode, std::move(pool));
+    }
+
+    /**
+     * @brief Emits a single value.
+     * @param value Value to pass to the listeners.
+     */
+    void Invoke(const T &value) { InvokeBatch(std::span<const T>(&value, 1)); }
+
+    /**
+     * @brief Emits a run of values in one call.
+     * @param values Values to pass to the listeners. Empty runs are ignored.
+     */
+    void InvokeBatch(std::span<const T> values)
+    {
+      if (values.empty())
+        return;
+
+      batches_.Invoke(values);
+      items_.InvokeForEach(values);
+    }
+
+    /**
+     * @brief Returns statistics for batch listeners followed by per-item
+     * listeners.
+     * @see Signal::GetListenerStats
+     */
+    std::vector<ListenerStats> GetListenerStats() const
+    {
+      std::vector<ListenerStats> stats = batches_.GetListenerStats();
+      for (auto &entry : items_.GetListenerStats())
+      {
+        stats.push_back(std::move(entry));
+      }
+      return stats;
     }
 
   private:
-    std::map<std::uint64_t, Callback> callbacks_;
-    std::uint64_t next_id_ = 0;
-    std::mutex mutex_;
+    Signal<std::span<const T>> batches_;
+    Signal<const T &> items_;
+  };
+
+  /**
+   * @class ConflatingSignal
+   * @brief "Latest value" mailbox for consumers that only need the newest
+   * value.
+   * @tparam T Trivially copyable value type.
+   *
+   * Publish overwrites a single slot and never waits, allocates or notifies
+   * anyone, so its cost does not depend on the number of consumers.
+   * Consumers either poll with TryRead or connect a callback that is woken at
+   * a fixed maximum rate and only called when a newer value is available.
+   * All connected callbacks share one timer thread owned by the signal.
+   */
+  template <typename T>
+  class ConflatingSignal
+  {
+  public:
+    using Callback = Delegate<void(const T &)>;
+
+    ConflatingSignal() = default;
+    ConflatingSignal(const ConflatingSignal &) = delete;
+    ConflatingSignal &operator=(const ConflatingSignal &) = delete;
+
+    /**
+     * @brief Destructor. Stops the timer thread after the running callback,
+     * if any, has returned.
+     *
+     * Connection tokens may outlive the signal. The signal must not be
+     * destroyed from within one of its callbacks.
+     */
+    ~ConflatingSignal()
+    {
+      {
+        std::lock_guard<std::mutex> lock(timer_->mutex);
+        timer_->stop = true;
+      }
+      timer_->wake.notify_all();
+      if (thread_.joinable())
+      {
+        thread_.join();
+      }
+    }
+
+    /**
+     * @brief Replaces the current value.
+     * @param value New value.
+     */
+    void Publish(const T &value) { slot_.Store(value); }
+
+    /**
+     * @brief Reads the current value if it is newer than the last one seen.
+     * @param out Receives the value.
+     * @param seen_version Version returned by the previous successful call
+     * (0 initially). Updated on success.
+     * @return True if a newer value was read.
+     */
+    bool TryRead(T &out, std::uint64_t &seen_version) const
+    {
+      if (slot_.GetSequence() == seen_version)
+        return false;
+
+      T value;
+      std::uint64_t version = slot_.Load(value);
+      if (version == seen_version)
+        return false;
+
+      out = value;
+      seen_version = version;
+      return true;
+    }
+
+    /**
+     * @brief Registers a consumer woken at most max_rate_hz times per second.
+     * @param cb Callback receiving the newest value. Runs on the signal's
+     * timer thread, so a slow callback delays the other consumers.
+     * @param max_rate_hz Maximum number of calls per second.
+     * @return Connection token. Once it is destroyed the callback is not
+     * running and will not be called again, unless the token is destroyed
+     * from within the callback.
+     */
+    [[nodiscard]] SignalToken Connect(Callback cb, double max_rate_hz)
+    {
+      auto consumer = std::make_shared<Consumer>();
+      consumer->callback = std::move(cb);
+      consumer->period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double>(max_rate_hz > 0.0 ? 1.0 / max_rate_hz : 1.0));
+      consumer->deadline = std::chrono::steady_clock::now() + consumer->period;
+
+      {
+        std::lock_guard<std::mutex> lock(timer_->mutex);
+        timer_->consumers.push_back(consumer);
+        if (!thread_.joinable())
+        {
+          thread_ = std::thread([this]()
+                                { RunTimer(); });
+        }
+      }
+      timer_->wake.notify_all();
+
+      // The token shares the consumer list, not the signal, so it may be
+      // destroyed after the signal.
+      return std::make_unique<ScopedConnection>(
+          [timer = timer_, consumer = consumer.get()]()
+          { timer->Remove(consumer); });
+    }
+
+  private:
+    struct Consumer
+    {
+      Callback callback;
+      std::chrono::steady_clock::duration period{};
+      std::chrono::steady_clock::time_point deadline;
+      std::uint64_t seen_version = 0; // Only touched by the timer thread.
+    };
+
+    /**
+     * @brief Consumer list and timer thread state, shared with the tokens.
+     */
+    struct Timer
+    {
+      void Remove(const Consumer *consumer)
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        std::erase_if(consumers, [consumer](const auto &entry)
+                      { return entry.get() == consumer; });
+        if (thread != std::this_thread::get_id())
+        {
+          idle.wait(lock, [this, consumer]()
+                    { return running != consumer; });
+        }
+      }
+
+      std::vector<std::shared_ptr<Consumer>> consumers;
+      const Consumer *running = nullptr;
+      std::thread::id thread;
+      bool stop = false;
+      std::mutex mutex;
+      std::condition_variable wake;
+      std::condition_variable idle;
+    };
+
+    void RunTimer()
+    {
+      Timer &timer = *timer_;
+      std::unique_lock<std::mutex> lock(timer.mutex);
+      timer.thread = std::this_thread::get_id();
+      T value;
+      while (!timer.stop)
+      {
+        auto now = std::chrono::steady_clock::now();
+        std::shared_ptr<Consumer> due;
+        auto next = std::chrono::steady_clock::time_point::max();
+        for (const auto &consumer : timer.consumers)
+        {
+          if (consumer->deadline <= now)
+          {
+            due = consumer;
+            break;
+          }
+          next = std::min(next, consumer->deadline);
+        }
+
+        if (!due)
+        {
+          timer.wake.wait_until(lock, next);
+          continue;
+        }
+
+        // Skip missed ticks instead of bursting to catch up.
+        due->deadline += due->period;
+        if (due->deadline <= now)
+        {
+          due->deadline = now + due->period;
+        }
+        timer.running = due.get();
+        lock.unlock();
+        if (TryRead(value, due->seen_version))
+        {
+          due->callback(value);
+        }
+        lock.lock();
+        timer.running = nullptr;
+        timer.idle.notify_all();
+      }
+    }
+
+    SeqLock<T> slot_;
+    std::shared_ptr<Timer> timer_ = std::make_shared<Timer>();
+    std::thread thread_;
   };
 
 } // namespace gcs::common
@@ -0,0 +1,166 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_COMMON_EXECUTOR_H_
+#define GCS_CORE_COMMON_EXECUTOR_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/delegate.h"
+
+namespace gcs::common
+{
+
+  /**
+   * @brief Type alias for a unit of work posted to an executor.
+   */
+  using Task = Delegate<void()>;
+
+  /**
+   * @interface IExecutor
+   * @brief Runs posted tasks on some thread of execution.
+   */
+  class IExecutor
+  {
+  public:
+    virtual ~IExecutor() = default;
+
+    /**
+     * @brief Schedules a task. Never runs the task on the calling thread.
+     * @param task Task to run.
+     */
+    virtual void Post(Task task) = 0;
+
+    /**
+     * @brief Checks whether the calling thread is the only one that runs
+     * this executor's tasks, so waiting on it for a posted task would never
+     * return.
+     */
+    virtual bool RunsTasksOnlyOnCurrentThread() const { return false; }
+
+    /**
+     * @brief Checks whether the calling thread is one of the threads that
+     * run this executor's tasks, so destroying the executor here would wait
+     * on itself.
+     */
+    virtual bool RunsTasksOnCurrentThread() const { return false; }
+  };
+
+  /**
+   * @class ThreadPoolExecutor
+   * @brief Work-stealing executor backed by a fixed set of worker threads.
+   *
+   * Every worker owns a task deque. Tasks posted from a worker go to its own
+   * deque and are run newest-first; tasks posted from other threads go to a
+   * shared injection queue. Idle workers steal the oldest task from their
+   * peers. Pending tasks are discarded when the executor is destroyed, as
+   * are tasks posted once destruction has begun; tasks already running are
+   * allowed to finish. The executor must not be destroyed on one of its own
+   * workers.
+   */
+  class ThreadPoolExecutor : public IExecutor
+  {
+  public:
+    /**
+     * @brief Constructor. Starts the worker threads.
+     * @param thread_count Number of workers (at least one).
+     */
+    explicit ThreadPoolExecutor(
+        std::size_t thread_count = std::thread::hardware_concurrency());
+
+    /**
+     * @brief Destructor. Stops and joins all workers.
+     */
+    ~ThreadPoolExecutor() override;
+
+    ThreadPoolExecutor(const ThreadPoolExecutor &) = delete;
+    ThreadPoolExecutor &operator=(const ThreadPoolExecutor &) = delete;
+
+    void Post(Task task) override;
+
+    /**
+     * @brief True when called from the worker of a single-thread pool.
+     */
+    bool RunsTasksOnlyOnCurrentThread() const override;
+
+    /**
+     * @brief True when called from any worker of this pool.
+     */
+    bool RunsTasksOnCurrentThread() const override;
+
+    /**
+     * @brief Returns the number of worker threads.
+     */
+    std::size_t GetThreadCount() const { return workers_.size(); }
+
+  private:
+    struct WorkerQueue
+    {
+      std::deque<Task> tasks;
+      std::mutex mutex;
+    };
+
+    void WorkerLoop(std::size_t index);
+    bool TryPop(std::size_t index, Task &task);
+    std::size_t CurrentWorkerIndex() const;
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    std::vector<std::thread> workers_;
+    std::deque<Task> injected_;
+    std::atomic<std::size_t> pending_ = 0;
+    bool stopping_ = false;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+  };
+
+  /**
+   * @class DedicatedThreadExecutor
+   * @brief Executor that runs every task on its own single thread.
+   *
+   * Tasks run one at a time, in the order they were posted.
+   */
+  class DedicatedThreadExecutor final : public ThreadPoolExecutor
+  {
+  public:
+    DedicatedThreadExecutor() : ThreadPoolExecutor(1) {}
+  };
+
+  /**
+   * @class ManualExecutor
+   * @brief Executor whose tasks run only when the owner pumps it.
+   *
+   * Suited to UI loops that drain their event queue once per frame.
+   */
+  class ManualExecutor final : public IExecutor
+  {
+  public:
+    void Post(Task task) override;
+
+    /**
+     * @brief True when called from the thread that last pumped the executor.
+     */
+    bool RunsTasksOnlyOnCurrentThread() const override;
+
+    /**
+     * @brief Runs the tasks that were pending when the call started.
+     * @return Number of tasks executed.
+     */
+    std::size_t RunPending();
+
+  private:
+    std::deque<Task> tasks_;
+    std::atomic<std::thread::id> pump_thread_;
+    std::mutex mutex_;
+  };
+
+} // namespace gcs::common
+
+#endif // GCS_CORE_COMMON_EXECUTOR_H_
@@ -0,0 +1,128 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_COMMON_LATENCY_HISTOGRAM_H_
+#define GCS_CORE_COMMON_LATENCY_HISTOGRAM_H_
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace gcs::common
+{
+
+  /**
+   * @class LatencyHistogram
+   * @brief Log-linear histogram of durations in nanoseconds.
+   *
+   * Values below 8 ns get one bucket each; every power of two above that is
+   * split into four linear sub-buckets, so the relative bucket width stays
+   * below 25% over the whole 64-bit range. Recording is a single relaxed
+   * atomic increment and is safe from any number of threads.
+   */
+  class LatencyHistogram
+  {
+  public:
+    static constexpr std::size_t kLinearBuckets = 8;
+    static constexpr std::size_t kSubBucketBits = 2;
+    static constexpr std::size_t kSubBuckets = std::size_t{1} << kSubBucketBits;
+    static constexpr std::size_t kBucketCount =
+        kLinearBuckets + (64 - 3) * kSubBuckets;
+
+    /**
+     * @brief Plain copy of the bucket counts.
+     */
+    using Counts = std::array<std::uint64_t, kBucketCount>;
+
+    /**
+     * @brief Records one duration.
+     * @param duration Duration to record. Negative values count as zero.
+     */
+    void Record(std::chrono::nanoseconds duration)
+    {
+      auto ns = duration.count() > 0 ? static_cast<std::uint64_t>(duration.count())
+                                     : std::uint64_t{0};
+      buckets_[BucketIndex(ns)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Copies the current bucket counts.
+     */
+    Counts GetCounts() const
+    {
+      Counts counts;
+      for (std::size_t i = 0; i < kBucketCount; ++i)
+      {
+        counts[i] = buckets_[i].load(std::memory_order_relaxed);
+      }
+      return counts;
+    }
+
+    /**
+     * @brief Maps a value in nanoseconds to its bucket.
+     */
+    static constexpr std::size_t BucketIndex(std::uint64_t ns)
+    {
+      if (ns < kLinearBuckets)
+        return static_cast<std::size_t>(ns);
+
+      std::size_t exponent = std::bit_width(ns) - 1;
+      std::size_t sub = (ns >> (exponent - kSubBucketBits)) & (kSubBuckets - 1);
+      return kLinearBuckets + (exponent - 3) * kSubBuckets + sub;
+    }
+
+    /**
+     * @brief Smallest value (in nanoseconds) that falls into a bucket.
+     */
+    static constexpr std::uint64_t BucketLowerBound(std::size_t index)
+    {
+      if (index < kLinearBuckets)
+        return index;
+
+      std::size_t exponent = 3 + (index - kLinearBuckets) / kSubBuckets;
+      std::uint64_t sub = (index - kLinearBuckets) % kSubBuckets;
+      return (kSubBuckets + sub) << (exponent - kSubBucketBits);
+    }
+
+    /**
+     * @brief Estimates a percentile from bucket counts.
+     * @param counts Counts returned by GetCounts.
+     * @param fraction Percentile as a fraction (0.99 for p99).
+     * @return Lower bound of the bucket holding the percentile, or zero if the
+     * histogram is empty.
+     */
+    static std::chrono::nanoseconds Percentile(const Counts &counts,
+                                               double fraction)
+    {
+      std::uint64_t total = 0;
+      for (std::uint64_t count : counts)
+      {
+        total += count;
+      }
+      if (total == 0)
+        return std::chrono::nanoseconds(0);
+
+      auto rank = static_cast<std::uint64_t>(fraction * static_cast<double>(total - 1));
+      std::uint64_t seen = 0;
+      for (std::size_t i = 0; i < kBucketCount; ++i)
+      {
+        seen += counts[i];
+        if (seen > rank)
+        {
+          return std::chrono::nanoseconds(BucketLowerBound(i));
+        }
+      }
+      return std::chrono::nanoseconds(BucketLowerBound(kBucketCount - 1));
+    }
+
+  private:
+    std::array<std::atomic<std::uint64_t>, kBucketCount> buckets_{};
+  };
+
+} // namespace gcs::common
+
+#endif // GCS_CORE_COMMON_LATENCY_HISTOGRAM_H_
@@ -0,0 +1,287 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_COMMON_LISTENER_QUEUE_H_
+#define GCS_CORE_COMMON_LISTENER_QUEUE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/delegate.h"
+#include "common/executor.h"
+
+namespace gcs::common
+{
+
+  /**
+   * @enum OverflowPolicy
+   * @brief What a queued connection does when its queue is full.
+   */
+  enum class OverflowPolicy
+  {
+    kBlock,      ///< The producer waits until the listener frees a slot.
+    kDropOldest, ///< The oldest pending event is discarded.
+    kDropNewest  ///< The incoming event is discarded.
+  };
+
+  /**
+   * @struct QueueOptions
+   * @brief Configuration of a queued (asynchronous) connection.
+   *
+   * OverflowPolicy::kBlock needs the listener to run on a thread other than
+   * the producer's. When the producer is itself the only thread running the
+   * executor (the thread pumping a ManualExecutor, or the worker of a
+   * single-thread pool), waiting would never end, so a full queue drops the
+   * incoming event instead, as with OverflowPolicy::kDropNewest. A producer
+   * that is one of several pool workers may still block if every worker
+   * waits on the same queue.
+   */
+  struct QueueOptions
+  {
+    std::shared_ptr<IExecutor> executor;                ///< Runs the listener.
+    std::size_t capacity = 256;                         ///< Max pending events.
+    OverflowPolicy overflow = OverflowPolicy::kDropOldest; ///< Full-queue policy.
+  };
+
+  /**
+   * @class ListenerQueueBase
+   * @brief Type-independent part of a listener queue: counters and shutdown.
+   */
+  class ListenerQueueBase
+  {
+  public:
+    virtual ~ListenerQueueBase() = default;
+
+    /**
+     * @brief Stops delivery and discards pending events.
+     *
+     * Waits for a listener call that is already running to return, unless it
+     * is called from inside that listener.
+     */
+    virtual void Close() = 0;
+
+    /**
+     * @brief Number of events waiting to be delivered.
+     */
+    std::size_t GetDepth() const { return depth_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Number of events discarded because the queue was full.
+     */
+    std::uint64_t GetDroppedCount() const
+    {
+      return dropped_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Number of events delivered to the listener.
+     */
+    std::uint64_t GetDeliveredCount() const
+    {
+      return delivered_.load(std::memory_order_relaxed);
+    }
+
+  protected:
+    std::atomic<std::size_t> depth_ = 0;
+    std::atomic<std::uint64_t> dropped_ = 0;
+    std::atomic<std::uint64_t> delivered_ = 0;
+  };
+
+  /**
+   * @class ListenerQueue
+   * @brief Bounded event queue drained by an executor.
+   * @tparam Args Signal argument types. Events are stored as decayed copies.
+   *
+   * At most one drain task is scheduled at a time, so the listener is never
+   * called concurrently with itself and sees events in order.
+   */
+  template <typename... Args>
+  class ListenerQueue final
+      : public ListenerQueueBase,
+        public std::enable_shared_from_this<ListenerQueue<Args...>>
+  {
+  public:
+    using Callback = Delegate<void(Args...)>;
+    using Event = std::tuple<std::decay_t<Args>...>;
+
+    /**
+     * @brief Constructor.
+     * @param callback Listener to run on the executor.
+     * @param options Queue configuration. options.executor must not be null.
+     */
+    ListenerQueue(Callback callback, QueueOptions options)
+        : callback_(std::move(callback)),
+          executor_(std::move(options.executor)),
+          overflow_(options.overflow),
+          ring_(options.capacity > 0 ? options.capacity : 1) {}
+
+    /**
+     * @brief Enqueues a copy of the event and schedules delivery.
+     * @param args Event arguments.
+     */
+    void Push(Args... args)
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (closed_)
+        return;
+
+      if (count_ == ring_.size())
+      {
+        switch (overflow_)
+        {
+        case OverflowPolicy::kBlock:
+          if (executor_->RunsTasksOnlyOnCurrentThread())
+          {
+            // Nobody else can drain the queue; see QueueOptions.
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+          }
+          not_full_.wait(lock, [this]()
+                         { return closed_ || count_ < ring_.size(); });
+          if (closed_)
+            return;
+          break;
+        case OverflowPolicy::kDropOldest:
+          PopLocked();
+          dropped_.fetch_add(1, std::memory_order_relaxed);
+          break;
+        case OverflowPolicy::kDropNewest:
+          dropped_.fetch_add(1, std::memory_order_relaxed);
+          return;
+        }
+      }
+
+      ring_[(head_ + count_) % ring_.size()].emplace(std::forward<Args>(args)...);
+      ++count_;
+      depth_.store(count_, std::memory_order_relaxed);
+
+      if (!scheduled_)
+      {
+        scheduled_ = true;
+        ScheduleLocked();
+      }
+    }
+
+    void Close() override
+    {
+      std::shared_ptr<IExecutor> executor;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        closed_ = true;
+        while (count_ > 0)
+        {
+          PopLocked();
+        }
+        depth_.store(0, std::memory_order_relaxed);
+        executor.swap(executor_);
+        not_full_.notify_all();
+
+        if (running_ && running_thread_ != std::this_thread::get_id())
+        {
+          idle_.wait(lock, [this]()
+                     { return !running_; });
+        }
+      }
+      ReleaseExecutor(std::move(executor));
+    }
+
+  private:
+    // Maximum events delivered by one drain task before it yields the
+    // executor thread to other work.
+    static constexpr std::size_t kDrainBatch = 64;
+
+    void ScheduleLocked()
+    {
+      executor_->Post([self = this->shared_from_this()]()
+                      { self->Drain(); });
+    }
+
+    // Drops the queue's executor reference. A listener that disconnects
+    // itself runs on the executor, and destroying the executor there would
+    // make it join its own thread, so the last reference is released on a
+    // separate thread instead.
+    static void ReleaseExecutor(std::shared_ptr<IExecutor> executor)
+    {
+      if (executor && executor.use_count() == 1 &&
+          executor->RunsTasksOnCurrentThread())
+      {
+        std::thread([executor = std::move(executor)]() mutable
+                    { executor.reset(); })
+            .detach();
+      }
+    }
+
+    void PopLocked()
+    {
+      ring_[head_].reset();
+      head_ = (head_ + 1) % ring_.size();
+      --count_;
+    }
+
+    void Drain()
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      running_ = true;
+      running_thread_ = std::this_thread::get_id();
+
+      std::size_t delivered = 0;
+      while (!closed_ && count_ > 0 && delivered < kDrainBatch)
+      {
+        Event event = std::move(*ring_[head_]);
+        PopLocked();
+        depth_.store(count_, std::memory_order_relaxed);
+        not_full_.notify_one();
+        lock.unlock();
+
+        std::apply([this](auto &&...values)
+                   { callback_(std::move(values)...); },
+                   std::move(event));
+        delivered_.fetch_add(1, std::memory_order_relaxed);
+        ++delivered;
+
+        lock.lock();
+      }
+
+      running_ = false;
+      if (!closed_ && count_ > 0)
+      {
+        ScheduleLocked();
+      }
+      else
+      {
+        scheduled_ = false;
+      }
+      idle_.notify_all();
+    }
+
+    Callback callback_;
+    std::shared_ptr<IExecutor> executor_;
+    OverflowPolicy overflow_;
+
+    std::vector<std::optional<Event>> ring_;
+    std::size_t head_ = 0;
+    std::size_t count_ = 0;
+    bool scheduled_ = false;
+    bool closed_ = false;
+    bool running_ = false;
+    std::thread::id running_thread_;
+
+    std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable idle_;
+  };
+
+} // namespace gcs::common
+
+#endif // GCS_CORE_COMMON_LISTENER_QUEUE_H_
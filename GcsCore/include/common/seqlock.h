@@ -0,0 +1,115 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_COMMON_SEQLOCK_H_
+#define GCS_CORE_COMMON_SEQLOCK_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace gcs::common
+{
+
+  /**
+   * @class SeqLock
+   * @brief Single-value slot with lock-free writes and optimistic reads.
+   * @tparam T Trivially copyable value type.
+   *
+   * A write never waits for readers. Readers copy the value and retry if a
+   * write overlapped the copy. The payload is kept in atomic words so that
+   * the optimistic copy is race-free.
+   */
+  template <typename T>
+  class SeqLock
+  {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "SeqLock requires a trivially copyable type");
+
+    static constexpr std::size_t kWords =
+        (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+  public:
+    /**
+     * @brief Stores a new value.
+     * @param value Value to publish.
+     *
+     * Concurrent writers are serialized; a single writer never spins.
+     */
+    void Store(const T &value)
+    {
+      std::uint64_t seq = seq_.load(std::memory_order_relaxed);
+      while ((seq & 1) != 0 ||
+             !seq_.compare_exchange_weak(seq, seq + 1, std::memory_order_relaxed))
+      {
+        if ((seq & 1) != 0)
+        {
+          std::this_thread::yield();
+          seq = seq_.load(std::memory_order_relaxed);
+        }
+      }
+      std::atomic_thread_fence(std::memory_order_release);
+
+      std::array<std::uint64_t, kWords> words{};
+      std::memcpy(words.data(), &value, sizeof(T));
+      for (std::size_t i = 0; i < kWords; ++i)
+      {
+        words_[i].store(words[i], std::memory_order_relaxed);
+      }
+
+      seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Reads a consistent copy of the value.
+     * @param out Receives the value.
+     * @return Sequence number of the value read. Each Store advances it by 2;
+     * 0 means nothing has been stored yet.
+     */
+    std::uint64_t Load(T &out) const
+    {
+      std::array<std::uint64_t, kWords> words;
+      while (true)
+      {
+        std::uint64_t before = seq_.load(std::memory_order_acquire);
+        if ((before & 1) != 0)
+        {
+          std::this_thread::yield();
+          continue;
+        }
+
+        for (std::size_t i = 0; i < kWords; ++i)
+        {
+          words[i] = words_[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (seq_.load(std::memory_order_relaxed) == before)
+        {
+          std::memcpy(static_cast<void *>(&out), words.data(), sizeof(T));
+          return before;
+        }
+      }
+    }
+
+    /**
+     * @brief Returns the sequence number of the latest completed Store.
+     */
+    std::uint64_t GetSequence() const
+    {
+      return seq_.load(std::memory_order_acquire) & ~std::uint64_t{1};
+    }
+
+  private:
+    std::atomic<std::uint64_t> seq_ = 0;
+    std::array<std::atomic<std::uint64_t>, kWords> words_{};
+  };
+
+} // namespace gcs::common
+
+#endif // GCS_CORE_COMMON_SEQLOCK_H_
@@ -0,0 +1,161 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_COMMON_STATIC_SIGNAL_H_
+#define GCS_CORE_COMMON_STATIC_SIGNAL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <tuple>
+#include <utility>
+
+namespace gcs::common
+{
+
+  /**
+   * @class StaticSignal
+   * @brief Event publisher whose listeners are fixed at compile time.
+   * @tparam Sinks Callable types of the listeners, invoked in order.
+   *
+   * The sinks are stored by value and called directly, so the compiler can
+   * inline the whole chain. There is no connecting, locking or allocation;
+   * the price is that the set of listeners cannot change at runtime. Use
+   * DynamicSink to hand events on to a regular Signal for runtime
+   * subscribers.
+   */
+  template <typename... Sinks>
+  class StaticSignal
+  {
+  public:
+    StaticSignal() = default;
+
+    /**
+     * @brief Constructor.
+     * @param sinks Listeners, in invocation order.
+     */
+    explicit StaticSignal(Sinks... sinks)
+      requires(sizeof...(Sinks) > 0)
+        : sinks_(std::move(sinks)...) {}
+
+    /**
+     * @brief Calls every sink with the given arguments.
+     * @param args Arguments passed to the sinks by const reference.
+     */
+    template <typename... Args>
+    void Invoke(const Args &...args)
+    {
+      std::apply([&](auto &...sink)
+                 { (sink(args...), ...); },
+                 sinks_);
+    }
+
+    /**
+     * @brief Returns the I-th sink.
+     */
+    template <std::size_t I>
+    auto &GetSink() { return std::get<I>(sinks_); }
+
+  private:
+    std::tuple<Sinks...> sinks_;
+  };
+
+  /**
+   * @class DynamicSink
+   * @brief Static sink that forwards events to a runtime Signal.
+   * @tparam SignalT Signal or BatchSignal type.
+   */
+  template <typename SignalT>
+  class DynamicSink
+  {
+  public:
+    /**
+     * @brief Constructor.
+     * @param signal Signal to forward to. Must outlive the sink.
+     */
+    explicit DynamicSink(SignalT &signal) : signal_(&signal) {}
+
+    template <typename... Args>
+    void operator()(const Args &...args) const
+    {
+      signal_->Invoke(args...);
+    }
+
+  private:
+    SignalT *signal_;
+  };
+
+  namespace detail
+  {
+    /**
+     * @brief Callable accepting anything; used to probe stage interfaces.
+     */
+    struct AnyEmitter
+    {
+      template <typename... T>
+      void operator()(const T &...) const {}
+    };
+  } // namespace detail
+
+  /**
+   * @concept StaticParserStage
+   * @brief Parser that hands completed packets to a callable instead of a
+   * Signal: `parser.Parse(bytes, emit)` calls `emit(packet)` per packet.
+   */
+  template <typename P>
+  concept StaticParserStage =
+      requires(P &parser, std::span<const std::uint8_t> bytes,
+               detail::AnyEmitter emit) { parser.Parse(bytes, emit); };
+
+  /**
+   * @class StaticPipeline
+   * @brief Byte -> packet -> telemetry -> sinks chain wired at compile time.
+   * @tparam Parser Concrete parser satisfying StaticParserStage.
+   * @tparam Converter Concrete converter; `converter.Convert(packet, emit)`
+   * calls `emit(values...)` for every converted result.
+   * @tparam Sinks Callables receiving the converted results.
+   *
+   * Every hop is a direct call on a concrete type, so the hot path contains
+   * no type erasure or virtual dispatch. Parser and converter types can also
+   * implement IParser and IConverter by forwarding their virtual entry
+   * points to the same Parse and Convert templates.
+   */
+  template <StaticParserStage Parser, typename Converter, typename... Sinks>
+  class StaticPipeline
+  {
+  public:
+    /**
+     * @brief Constructor.
+     * @param parser Parser stage.
+     * @param converter Converter stage.
+     * @param sinks Listeners for the converted results, in invocation order.
+     */
+    StaticPipeline(Parser parser, Converter converter, Sinks... sinks)
+        : parser_(std::move(parser)), converter_(std::move(converter)),
+          output_(std::move(sinks)...) {}
+
+    /**
+     * @brief Runs a chunk of raw bytes through the whole chain.
+     * @param data Raw bytes, e.g. as received from the serial port.
+     */
+    void PushData(std::span<const std::uint8_t> data)
+    {
+      parser_.Parse(data, [this](const auto &packet)
+                    { converter_.Convert(packet, [this](const auto &...values)
+                                         { output_.Invoke(values...); }); });
+    }
+
+    Parser &GetParser() { return parser_; }
+    Converter &GetConverter() { return converter_; }
+    StaticSignal<Sinks...> &GetOutput() { return output_; }
+
+  private:
+    Parser parser_;
+    Converter converter_;
+    StaticSignal<Sinks...> output_;
+  };
+
+} // namespace gcs::common
+
+#endif // GCS_CORE_COMMON_STATIC_SIGNAL_H_
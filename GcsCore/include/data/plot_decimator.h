@@ -0,0 +1,152 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_DATA_PLOT_DECIMATOR_H_
+#define GCS_CORE_DATA_PLOT_DECIMATOR_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/config.h"
+#include "data/telemetry_channel.h"
+#include "data/telemetry_column_store.h"
+
+namespace gcs::data
+{
+
+  /**
+   * @struct PlotPoint
+   * @brief One display point of a decimated channel.
+   */
+  struct PlotPoint
+  {
+    std::uint64_t timestamp_us; ///< Timestamp of the source frame (us).
+    double value;               ///< Channel value of the source frame.
+  };
+
+  /**
+   * @enum DecimationMode
+   * @brief Point selection of PlotDecimator.
+   */
+  enum class DecimationMode
+  {
+    /**
+     * Splits the range into equal buckets and keeps the minimum and maximum
+     * of each, so spikes are never lost.
+     */
+    kMinMax,
+    /**
+     * Largest-Triangle-Three-Buckets: keeps the point of each bucket that
+     * forms the largest triangle with its neighbours, preserving the visual
+     * shape. Long ranges run it over min/max candidates (MinMaxLTTB) so the
+     * cost stays proportional to the point budget.
+     */
+    kLttb
+  };
+
+  /**
+   * @class PlotDecimator
+   * @brief Reduces channel ranges of a TelemetryColumnStore to a bounded
+   * number of display points.
+   *
+   * For every floating-point channel the decimator keeps a min/max tree over
+   * the store: leaves summarize kLeafFrames frames and each level above
+   * halves the node count. Update() extends the tree with the frames
+   * appended since the last call, so the cost of a live plot is paid once
+   * per frame. A query splits its range into buckets and answers each from
+   * O(log n) tree nodes plus at most two leaves of raw frames, so its cost
+   * depends on the point budget, not on the zoom level or flight length.
+   *
+   * Like the store, the decimator is not synchronized; Update() and queries
+   * must not overlap with each other or with appends to the store.
+   */
+  class PlotDecimator
+  {
+  public:
+    /**
+     * @brief Frames per tree leaf.
+     */
+    static constexpr std::size_t kLeafFrames =
+        gcs::common::kPlotDecimatorLeafFrames;
+
+    /**
+     * @brief Creates a decimator over a store. The store must outlive it.
+     */
+    explicit PlotDecimator(const TelemetryColumnStore &store);
+
+    /**
+     * @brief Summarizes the frames appended to the store since the last
+     * call.
+     */
+    void Update();
+
+    /**
+     * @brief Drops all summaries; call after clearing the store.
+     */
+    void Reset();
+
+    /**
+     * @brief Decimates the frames whose timestamp lies in [begin, end].
+     * Timestamps must be non-decreasing.
+     * @param channel Channel to plot.
+     * @param begin First timestamp (us).
+     * @param end Last timestamp (us).
+     * @param max_points Point budget; at least 4 points are returned for
+     * large ranges.
+     * @param mode Point selection.
+     * @param out Replaced by the points, in frame order.
+     */
+    void Decimate(TelemetryChannel channel, std::uint64_t begin,
+                  std::uint64_t end, std::size_t max_points,
+                  DecimationMode mode, std::vector<PlotPoint> &out) const;
+
+    /**
+     * @brief Decimates the frames [first, last) by index.
+     * @see Decimate()
+     */
+    void DecimateFrames(TelemetryChannel channel, std::size_t first,
+                        std::size_t last, std::size_t max_points,
+                        DecimationMode mode,
+                        std::vector<PlotPoint> &out) const;
+
+  private:
+    // Extremes of a frame range. An empty node has min > max.
+    struct Node
+    {
+      double min;
+      double max;
+      std::uint32_t min_frame;
+      std::uint32_t max_frame;
+    };
+
+    // levels[0] holds the leaves; the last node of each level may cover
+    // fewer frames than the others while the flight is still growing.
+    using Tree = std::vector<std::vector<Node>>;
+
+    static Node EmptyNode();
+    static void Merge(Node &into, const Node &node);
+
+    Node ScanFrames(TelemetryChannel channel, std::size_t first,
+                    std::size_t last) const;
+    Node QueryRange(TelemetryChannel channel, std::size_t first,
+                    std::size_t last) const;
+    PlotPoint MakePoint(TelemetryChannel channel, std::size_t frame) const;
+
+    void AppendMinMax(TelemetryChannel channel, std::size_t first,
+                      std::size_t last, std::size_t buckets,
+                      std::vector<PlotPoint> &out) const;
+    void AppendLttb(TelemetryChannel channel, std::size_t first,
+                    std::size_t last, std::size_t max_points,
+                    std::vector<PlotPoint> &out) const;
+
+    const TelemetryColumnStore *store_;
+    std::size_t summarized_ = 0; // Frames folded into complete leaves.
+    std::array<Tree, kTelemetryChannelCount> trees_;
+  };
+
+} // namespace gcs::data
+
+#endif // GCS_CORE_DATA_PLOT_DECIMATOR_H_
@@ -104,21 +104,22 @@ namespace gcs::data
    * @brief Integrated telemetry data structure.
    *
    * Contains all major information such as system status, position, attitude, etc.
-   * This structure can be directly written to binary log files.
+   * Converters fill timestamp_us from the device clock; 32-bit device
+   * counters are extended with a TimestampUnwrapper.
    */
   struct TelemetryData
   {
-    std::uint32_t timestamp = 0; ///< System uptime (ms).
-    Vec3 pos;                    ///< Position (m).
-    Vec3 vel;                    ///< Velocity (m/s).
-    Vec3 acc;                    ///< Acceleration (m/s^2).
-    Quat quat;                   ///< Attitude quaternion (W, X, Y, Z).
-    Vec3 euler;                  ///< Attitude euler (roll, pitch, yaw).
-    std::uint32_t rx_count = 0;  ///< Received packet count.
-    std::uint32_t tx_count = 0;  ///< Transmitted packet count.
-    std::uint8_t fsm = 0;        ///< Finite State Machine (FSM) state value.
-    std::uint8_t sensor = 0;     ///< Sensor status flags.
-    std::uint8_t ejection = 0;   ///< Ejection Type
+    std::uint64_t timestamp_us = 0; ///< System uptime (us), unwrapped.
+    Vec3 pos;                       ///< Position (m).
+    Vec3 vel;                       ///< Velocity (m/s).
+    Vec3 acc;                       ///< Acceleration (m/s^2).
+    Quat quat;                      ///< Attitude quaternion (W, X, Y, Z).
+    Vec3 euler;                     ///< Attitude euler (roll, pitch, yaw).
+    std::uint32_t rx_count = 0;     ///< Received packet count.
+    std::uint32_t tx_count = 0;     ///< Transmitted packet count.
+    std::uint8_t fsm = 0;           ///< Finite State Machine (FSM) state value.
+    std::uint8_t sensor = 0;        ///< Sensor status flags.
+    std::uint8_t ejection = 0;      ///< Ejection Type
   };
 
 } // namespace gcs::data
@@ -0,0 +1,108 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_DATA_TELEMETRY_CHANNEL_H_
+#define GCS_CORE_DATA_TELEMETRY_CHANNEL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "data/telemetry.h"
+
+namespace gcs::data
+{
+
+  /**
+   * @enum TelemetryChannel
+   * @brief Floating-point channels of TelemetryData, in declaration order.
+   */
+  enum class TelemetryChannel : std::uint8_t
+  {
+    kPosX,
+    kPosY,
+    kPosZ,
+    kVelX,
+    kVelY,
+    kVelZ,
+    kAccX,
+    kAccY,
+    kAccZ,
+    kQuatW,
+    kQuatX,
+    kQuatY,
+    kQuatZ,
+    kEulerX,
+    kEulerY,
+    kEulerZ,
+    kCount
+  };
+
+  /**
+   * @brief Number of floating-point channels.
+   */
+  inline constexpr std::size_t kTelemetryChannelCount =
+      static_cast<std::size_t>(TelemetryChannel::kCount);
+
+  /**
+   * @brief Reads one channel of a frame.
+   * @param frame Telemetry frame.
+   * @param channel Channel to read. Must not be TelemetryChannel::kCount.
+   * @return Value of the channel.
+   */
+  inline double GetChannelValue(const TelemetryData &frame,
+                                TelemetryChannel channel)
+  {
+    auto index = static_cast<std::size_t>(channel);
+    if (index < 3)
+      return frame.pos.data[index];
+    if (index < 6)
+      return frame.vel.data[index - 3];
+    if (index < 9)
+      return frame.acc.data[index - 6];
+    if (index < 13)
+      return frame.quat.data[index - 9];
+    return frame.euler.data[index - 13];
+  }
+
+  /**
+   * @brief Writes one channel of a frame.
+   * @param frame Telemetry frame.
+   * @param channel Channel to write. Must not be TelemetryChannel::kCount.
+   * @param value New value.
+   */
+  inline void SetChannelValue(TelemetryData &frame, TelemetryChannel channel,
+                              double value)
+  {
+    auto index = static_cast<std::size_t>(channel);
+    if (index < 3)
+      frame.pos.data[index] = value;
+    else if (index < 6)
+      frame.vel.data[index - 3] = value;
+    else if (index < 9)
+      frame.acc.data[index - 6] = value;
+    else if (index < 13)
+      frame.quat.data[index - 9] = value;
+    else
+      frame.euler.data[index - 13] = value;
+  }
+
+  /**
+   * @brief Returns a stable, human-readable channel name (e.g. "pos.z").
+   */
+  inline std::string_view GetChannelName(TelemetryChannel channel)
+  {
+    static constexpr std::string_view kNames[kTelemetryChannelCount] = {
+        "pos.x", "pos.y", "pos.z",
+        "vel.x", "vel.y", "vel.z",
+        "acc.x", "acc.y", "acc.z",
+        "quat.w", "quat.x", "quat.y", "quat.z",
+        "euler.x", "euler.y", "euler.z"};
+    auto index = static_cast<std::size_t>(channel);
+    return index < kTelemetryChannelCount ? kNames[index] : std::string_view();
+  }
+
+} // namespace gcs::data
+
+#endif // GCS_CORE_DATA_TELEMETRY_CHANNEL_H_
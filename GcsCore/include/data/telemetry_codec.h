@@ -0,0 +1,230 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_DATA_TELEMETRY_CODEC_H_
+#define GCS_CORE_DATA_TELEMETRY_CODEC_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "common/config.h"
+#include "data/telemetry.h"
+#include "data/telemetry_channel.h"
+
+namespace gcs::data
+{
+
+  /**
+   * @brief Version written into every encoded block.
+   */
+  inline constexpr std::uint8_t kTelemetryCodecVersion = 2;
+
+  /**
+   * @struct TelemetryBlockInfo
+   * @brief Location and time range of one encoded block.
+   */
+  struct TelemetryBlockInfo
+  {
+    std::size_t offset = 0;            ///< Byte offset within the stream.
+    std::size_t size = 0;              ///< Encoded size, header included.
+    std::uint32_t frame_count = 0;        ///< Frames in the block.
+    std::uint64_t first_timestamp_us = 0; ///< Timestamp of the first frame.
+    std::uint64_t last_timestamp_us = 0;  ///< Timestamp of the last frame.
+  };
+
+  namespace detail
+  {
+    // Prediction state shared by the encoder and decoder. Both sides update
+    // it identically after every frame.
+    struct TelemetryCodecState
+    {
+      static constexpr std::size_t kCounterCount = 3; // timestamp, rx, tx
+      static constexpr std::size_t kFlagCount = 3;    // fsm, sensor, ejection
+
+      // Width of each counter; counters wrap at their width.
+      static constexpr std::array<unsigned, kCounterCount> kCounterBits = {
+          64, 32, 32};
+
+      std::array<std::uint64_t, kCounterCount> counters{};
+      std::array<std::int64_t, kCounterCount> deltas{};
+      std::array<std::uint64_t, kTelemetryChannelCount> channels{};
+      std::array<std::uint8_t, kTelemetryChannelCount> leading{};
+      std::array<std::uint8_t, kTelemetryChannelCount> trailing{};
+      std::array<std::uint8_t, kFlagCount> flags{};
+    };
+  } // namespace detail
+
+  /**
+   * @class TelemetryEncoder
+   * @brief Streaming compressor for sequences of TelemetryData.
+   *
+   * Frames are grouped into independent blocks. The first frame of a block
+   * is stored verbatim; every following frame is coded against its
+   * predecessor:
+   * - timestamp, rx_count, tx_count: delta-of-delta with variable-length
+   *   buckets, so a steady rate costs one bit.
+   * - floating-point channels: XOR with the previous value, storing only
+   *   the meaningful bits between the leading and trailing zeros.
+   * - fsm, sensor, ejection: one bit while all three repeat, so long runs
+   *   cost one bit per frame.
+   *
+   * Each block starts with a header (see TelemetryBlockInfo), so a stream
+   * can be scanned and decoded from any block boundary.
+   */
+  class TelemetryEncoder
+  {
+  public:
+    /**
+     * @brief Size of the header in front of every block.
+     */
+    static constexpr std::size_t kBlockHeaderSize = 28;
+
+    /**
+     * @brief Creates an encoder.
+     * @param block_frames Frames per block; 0 is treated as 1.
+     */
+    explicit TelemetryEncoder(
+        std::size_t block_frames = gcs::common::kTelemetryCodecBlockFrames);
+
+    /**
+     * @brief Encodes one frame. The block is closed once it is full.
+     */
+    void Encode(const TelemetryData &frame);
+
+    /**
+     * @brief Encodes a run of frames.
+     */
+    void Encode(std::span<const TelemetryData> frames);
+
+    /**
+     * @brief Closes the open block, if any, even if it is not full.
+     */
+    void Flush();
+
+    /**
+     * @brief Returns the completed blocks.
+     */
+    std::span<const std::uint8_t> GetOutput() const
+    {
+      return std::span<const std::uint8_t>(output_.data(), block_start_);
+    }
+
+    /**
+     * @brief Moves the completed blocks out. The open block is kept.
+     */
+    std::vector<std::uint8_t> TakeOutput();
+
+    /**
+     * @brief Number of frames in the open block.
+     */
+    std::size_t GetPendingFrameCount() const { return frame_count_; }
+
+  private:
+    void BeginBlock(const TelemetryData &frame);
+    void EncodeDelta(const TelemetryData &frame);
+    void WriteBits(std::uint64_t value, unsigned count);
+    void WriteCounter(std::size_t index, std::uint64_t value);
+    void WriteChannel(std::size_t index, double value);
+
+    std::size_t block_frames_;
+    std::vector<std::uint8_t> output_;
+    std::size_t block_start_ = 0;
+    std::uint32_t frame_count_ = 0;
+    std::uint64_t first_timestamp_us_ = 0;
+    std::uint64_t last_timestamp_us_ = 0;
+
+    std::uint64_t bit_buffer_ = 0;
+    unsigned bit_count_ = 0;
+    detail::TelemetryCodecState state_;
+  };
+
+  /**
+   * @class TelemetryDecoder
+   * @brief Decodes a stream written by TelemetryEncoder, frame by frame.
+   *
+   * Decoding stops at the end of the stream or at the first malformed or
+   * truncated block.
+   */
+  class TelemetryDecoder
+  {
+  public:
+    /**
+     * @brief Creates a decoder positioned at the first block.
+     * @param stream Encoded blocks. Must outlive the decoder.
+     */
+    explicit TelemetryDecoder(std::span<const std::uint8_t> stream);
+
+    /**
+     * @brief Decodes the next frame.
+     * @return false at the end of the stream or on corrupt data.
+     */
+    bool Decode(TelemetryData &frame);
+
+    /**
+     * @brief Decodes up to frames.size() frames.
+     * @return Number of frames decoded.
+     */
+    std::size_t Decode(std::span<TelemetryData> frames);
+
+    /**
+     * @brief Continues decoding at the start of a block.
+     * @param offset Byte offset of the block, e.g. TelemetryBlockInfo::offset.
+     * @return false if no valid block starts there.
+     */
+    bool Seek(std::size_t offset);
+
+    /**
+     * @brief Parses the header of the block at offset.
+     * @return The block, or nullopt if it is malformed or truncated.
+     */
+    static std::optional<TelemetryBlockInfo> ReadBlockInfo(
+        std::span<const std::uint8_t> stream, std::size_t offset);
+
+    /**
+     * @brief Lists the valid blocks of a stream, stopping at the first
+     * invalid one. Use it to build an index for random access.
+     */
+    static std::vector<TelemetryBlockInfo> ScanBlocks(
+        std::span<const std::uint8_t> stream);
+
+  private:
+    void DecodeFirst(TelemetryData &frame);
+    void DecodeDelta(TelemetryData &frame);
+    std::uint64_t ReadBits(unsigned count);
+    std::uint64_t ReadCounter(std::size_t index);
+    double ReadChannel(std::size_t index);
+
+    std::span<const std::uint8_t> stream_;
+    std::size_t next_block_ = 0;
+    std::uint32_t remaining_ = 0;
+    bool first_ = false;
+
+    const std::uint8_t *cursor_ = nullptr;
+    const std::uint8_t *end_ = nullptr;
+    std::uint64_t bit_buffer_ = 0;
+    unsigned bit_count_ = 0;
+    bool overrun_ = false;
+    detail::TelemetryCodecState state_;
+  };
+
+  /**
+   * @brief Encodes a whole sequence of frames.
+   */
+  std::vector<std::uint8_t> EncodeTelemetry(
+      std::span<const TelemetryData> frames,
+      std::size_t block_frames = gcs::common::kTelemetryCodecBlockFrames);
+
+  /**
+   * @brief Decodes a whole stream, up to the first invalid block.
+   */
+  std::vector<TelemetryData> DecodeTelemetry(
+      std::span<const std::uint8_t> stream);
+
+} // namespace gcs::data
+
+#endif // GCS_CORE_DATA_TELEMETRY_CODEC_H_
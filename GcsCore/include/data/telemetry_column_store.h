@@ -0,0 +1,276 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_DATA_TELEMETRY_COLUMN_STORE_H_
+#define GCS_CORE_DATA_TELEMETRY_COLUMN_STORE_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "common/config.h"
+#include "data/telemetry.h"
+#include "data/telemetry_channel.h"
+
+namespace gcs::data
+{
+
+  /**
+   * @class TelemetryColumnStore
+   * @brief Structure-of-arrays history of telemetry frames.
+   *
+   * Every field of TelemetryData is stored in its own contiguous column, so
+   * scanning one channel only touches that channel's memory. Frames are kept
+   * in fixed-size chunks; within a chunk each column is a cache-line aligned
+   * array. Growing the store allocates a new chunk and never moves existing
+   * data, so appends have no reallocation stalls and column spans stay
+   * valid until Clear().
+   *
+   * The store is not synchronized; appends and reads must not overlap.
+   */
+  class TelemetryColumnStore
+  {
+  public:
+    /**
+     * @brief Number of frames per chunk.
+     */
+    static constexpr std::size_t kChunkFrames =
+        gcs::common::kTelemetryColumnChunkFrames;
+
+    /**
+     * @brief Alignment (in bytes) of every column array.
+     */
+    static constexpr std::size_t kColumnAlignment = 64;
+
+    /**
+     * @class Column
+     * @brief Read-only view of one column, as a sequence of chunk spans.
+     * @tparam T Element type of the column.
+     *
+     * Chunk i covers frames [i * kChunkFrames, i * kChunkFrames +
+     * GetChunk(i).size()).
+     */
+    template <typename T>
+    class Column
+    {
+    public:
+      /**
+       * @brief Number of frames in the column.
+       */
+      std::size_t GetFrameCount() const { return store_->frame_count_; }
+
+      /**
+       * @brief Number of chunks holding frames.
+       */
+      std::size_t GetChunkCount() const { return store_->GetChunkCount(); }
+
+      /**
+       * @brief Contiguous, aligned values of one chunk.
+       * @param chunk Chunk index, less than GetChunkCount().
+       */
+      std::span<const T> GetChunk(std::size_t chunk) const
+      {
+        std::size_t first = chunk * kChunkFrames;
+        std::size_t count = store_->frame_count_ - first;
+        if (count > kChunkFrames)
+          count = kChunkFrames;
+        return {Data(chunk), count};
+      }
+
+      /**
+       * @brief Value of one frame. The index must be less than
+       * GetFrameCount().
+       */
+      T operator[](std::size_t frame) const
+      {
+        return Data(frame / kChunkFrames)[frame % kChunkFrames];
+      }
+
+    private:
+      friend class TelemetryColumnStore;
+
+      Column(const TelemetryColumnStore &store, std::size_t column)
+          : store_(&store), offset_(kColumnOffsets[column]) {}
+
+      const T *Data(std::size_t chunk) const
+      {
+        return reinterpret_cast<const T *>(store_->chunks_[chunk].get() +
+                                           offset_);
+      }
+
+      const TelemetryColumnStore *store_;
+      std::size_t offset_;
+    };
+
+    TelemetryColumnStore() = default;
+
+    TelemetryColumnStore(const TelemetryColumnStore &) = delete;
+    TelemetryColumnStore &operator=(const TelemetryColumnStore &) = delete;
+    TelemetryColumnStore(TelemetryColumnStore &&other) noexcept
+        : chunks_(std::move(other.chunks_)),
+          frame_count_(std::exchange(other.frame_count_, 0)) {}
+
+    TelemetryColumnStore &operator=(TelemetryColumnStore &&other) noexcept
+    {
+      chunks_ = std::move(other.chunks_);
+      frame_count_ = std::exchange(other.frame_count_, 0);
+      return *this;
+    }
+
+    /**
+     * @brief Appends one frame.
+     */
+    void Append(const TelemetryData &frame);
+
+    /**
+     * @brief Appends a run of frames, filling each column chunk by chunk.
+     */
+    void Append(std::span<const TelemetryData> frames);
+
+    /**
+     * @brief Allocates chunks up front so that the next appends up to
+     * frame_count frames do not allocate.
+     */
+    void Reserve(std::size_t frame_count);
+
+    /**
+     * @brief Removes all frames and releases their memory.
+     */
+    void Clear();
+
+    /**
+     * @brief Number of stored frames.
+     */
+    std::size_t GetFrameCount() const { return frame_count_; }
+
+    /**
+     * @brief Number of chunks holding frames.
+     */
+    std::size_t GetChunkCount() const
+    {
+      return (frame_count_ + kChunkFrames - 1) / kChunkFrames;
+    }
+
+    /**
+     * @brief Reassembles one frame. The index must be less than
+     * GetFrameCount().
+     */
+    TelemetryData GetFrame(std::size_t index) const;
+
+    /**
+     * @brief Returns the column of a floating-point channel.
+     */
+    Column<double> GetChannel(TelemetryChannel channel) const
+    {
+      return Column<double>(*this, static_cast<std::size_t>(channel));
+    }
+
+    Column<std::uint64_t> GetTimestamps() const
+    {
+      return Column<std::uint64_t>(*this, kTimestampColumn);
+    }
+
+    Column<std::uint32_t> GetRxCounts() const
+    {
+      return Column<std::uint32_t>(*this, kRxCountColumn);
+    }
+
+    Column<std::uint32_t> GetTxCounts() const
+    {
+      return Column<std::uint32_t>(*this, kTxCountColumn);
+    }
+
+    Column<std::uint8_t> GetFsm() const
+    {
+      return Column<std::uint8_t>(*this, kFsmColumn);
+    }
+
+    Column<std::uint8_t> GetSensor() const
+    {
+      return Column<std::uint8_t>(*this, kSensorColumn);
+    }
+
+    Column<std::uint8_t> GetEjection() const
+    {
+      return Column<std::uint8_t>(*this, kEjectionColumn);
+    }
+
+  private:
+    // Floating-point channels occupy columns [0, kTelemetryChannelCount).
+    enum ColumnIndex : std::size_t
+    {
+      kTimestampColumn = kTelemetryChannelCount,
+      kRxCountColumn,
+      kTxCountColumn,
+      kFsmColumn,
+      kSensorColumn,
+      kEjectionColumn,
+      kColumnCount
+    };
+
+    static constexpr std::size_t ColumnWidth(std::size_t column)
+    {
+      if (column < kTelemetryChannelCount)
+        return sizeof(double);
+      if (column == kTimestampColumn)
+        return sizeof(std::uint64_t);
+      if (column < kFsmColumn)
+        return sizeof(std::uint32_t);
+      return sizeof(std::uint8_t);
+    }
+
+    // Byte offset of every column within a chunk; the last entry is the
+    // chunk size.
+    static constexpr std::array<std::size_t, kColumnCount + 1> ComputeOffsets()
+    {
+      std::array<std::size_t, kColumnCount + 1> offsets{};
+      std::size_t offset = 0;
+      for (std::size_t column = 0; column < kColumnCount; ++column)
+      {
+        offsets[column] = offset;
+        std::size_t bytes = kChunkFrames * ColumnWidth(column);
+        offset += (bytes + kColumnAlignment - 1) / kColumnAlignment *
+                  kColumnAlignment;
+      }
+      offsets[kColumnCount] = offset;
+      return offsets;
+    }
+
+    static const std::array<std::size_t, kColumnCount + 1> kColumnOffsets;
+
+    struct ChunkDeleter
+    {
+      void operator()(std::byte *chunk) const
+      {
+        ::operator delete[](chunk, std::align_val_t(kColumnAlignment));
+      }
+    };
+
+    using ChunkPtr = std::unique_ptr<std::byte[], ChunkDeleter>;
+
+    static ChunkPtr AllocateChunk();
+
+    template <typename T>
+    static T *ColumnData(std::byte *chunk, std::size_t column)
+    {
+      return reinterpret_cast<T *>(chunk + kColumnOffsets[column]);
+    }
+
+    std::vector<ChunkPtr> chunks_;
+    std::size_t frame_count_ = 0;
+  };
+
+  inline constexpr std::array<std::size_t,
+                              TelemetryColumnStore::kColumnCount + 1>
+      TelemetryColumnStore::kColumnOffsets =
+          TelemetryColumnStore::ComputeOffsets();
+
+} // namespace gcs::data
+
+#endif // GCS_CORE_DATA_TELEMETRY_COLUMN_STORE_H_
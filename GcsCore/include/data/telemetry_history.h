@@ -0,0 +1,135 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_DATA_TELEMETRY_HISTORY_H_
+#define GCS_CORE_DATA_TELEMETRY_HISTORY_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "common/config.h"
+#include "common/seqlock.h"
+#include "data/telemetry.h"
+
+namespace gcs::data
+{
+
+  /**
+   * @class TelemetryHistory
+   * @brief Fixed-capacity ring of recent telemetry shared by one producer and
+   * any number of readers.
+   *
+   * Frame n (counting from 0) is stored in slot n % capacity, so memory stays
+   * bounded and the producer copies each frame once no matter how many
+   * readers attach. Publishing is wait-free. Readers never block the
+   * producer; each slot is a SeqLock, and a reader compares the slot's
+   * store count with the one frame n must have to detect that the frame was
+   * overwritten meanwhile.
+   *
+   * Typical use is a single BatchSignal connection on the converter:
+   * @code
+   * converter->OnTelemetryConverted.ConnectBatch(
+   *     [&history](std::span<const TelemetryData> frames)
+   *     { history.Publish(frames); });
+   * @endcode
+   *
+   * Publish() must only be called from one thread at a time; all reads are
+   * safe from any thread.
+   */
+  class TelemetryHistory
+  {
+  public:
+    /**
+     * @brief Creates an empty history.
+     * @param capacity Frames kept; rounded up to a power of two.
+     */
+    explicit TelemetryHistory(
+        std::size_t capacity = gcs::common::kTelemetryHistoryCapacity);
+
+    TelemetryHistory(const TelemetryHistory &) = delete;
+    TelemetryHistory &operator=(const TelemetryHistory &) = delete;
+
+    /**
+     * @brief Appends one frame, overwriting the oldest one once full.
+     */
+    void Publish(const TelemetryData &frame);
+
+    /**
+     * @brief Appends a run of frames.
+     */
+    void Publish(std::span<const TelemetryData> frames);
+
+    /**
+     * @brief Number of frames the ring holds.
+     */
+    std::size_t GetCapacity() const { return mask_ + 1; }
+
+    /**
+     * @brief Total number of frames published so far. The newest frame has
+     * sequence number GetPublishedCount() - 1.
+     */
+    std::uint64_t GetPublishedCount() const
+    {
+      return published_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Reads one frame by sequence number.
+     * @return false if the frame has not been published yet or has been
+     * overwritten.
+     */
+    bool Read(std::uint64_t sequence, TelemetryData &frame) const;
+
+    /**
+     * @brief Reads the newest frame.
+     * @return false if nothing has been published yet.
+     */
+    bool ReadLatest(TelemetryData &frame) const;
+
+    /**
+     * @brief Copies up to count of the newest frames, oldest first.
+     * @param count Maximum number of frames.
+     * @param out Replaced by the frames read.
+     * @return Number of frames copied. Frames overwritten during the copy are
+     * left out, so the result is always a contiguous run.
+     */
+    std::size_t CopyLatest(std::size_t count,
+                           std::vector<TelemetryData> &out) const;
+
+    /**
+     * @brief Copies the frames whose timestamp lies within window of the
+     * newest frame, oldest first.
+     * @param window Time span to copy.
+     * @param out Replaced by the frames read.
+     * @return Number of frames copied.
+     */
+    std::size_t CopyRecent(std::chrono::microseconds window,
+                           std::vector<TelemetryData> &out) const;
+
+    /**
+     * @brief Appends all frames published since a cursor, for readers that
+     * consume the stream incrementally.
+     * @param cursor Sequence number of the next frame to read, 0 initially.
+     * Advanced past the frames read.
+     * @param out Frames are appended to it.
+     * @return Number of frames that were overwritten before they could be
+     * read, i.e. how far the reader fell behind.
+     */
+    std::uint64_t ReadSince(std::uint64_t &cursor,
+                            std::vector<TelemetryData> &out) const;
+
+  private:
+    std::size_t mask_;
+    std::unique_ptr<gcs::common::SeqLock<TelemetryData>[]> slots_;
+    alignas(64) std::atomic<std::uint64_t> published_ = 0;
+  };
+
+} // namespace gcs::data
+
+#endif // GCS_CORE_DATA_TELEMETRY_HISTORY_H_
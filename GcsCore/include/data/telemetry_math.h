@@ -0,0 +1,200 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_DATA_TELEMETRY_MATH_H_
+#define GCS_CORE_DATA_TELEMETRY_MATH_H_
+
+#include <cstddef>
+#include <span>
+
+#include "data/telemetry.h"
+
+namespace gcs::data
+{
+
+  /**
+   * @enum SimdLevel
+   * @brief Instruction set used by the batch math kernels.
+   */
+  enum class SimdLevel
+  {
+    kScalar, ///< Portable scalar code.
+    kSse4,   ///< SSE4.1, two doubles per instruction.
+    kAvx2    ///< AVX2, four doubles per instruction.
+  };
+
+  /**
+   * @brief Returns the best instruction set supported by this CPU and OS.
+   */
+  SimdLevel GetSupportedSimdLevel();
+
+  /**
+   * @brief Returns the instruction set the kernels currently dispatch to.
+   * Defaults to GetSupportedSimdLevel().
+   */
+  SimdLevel GetSimdLevel();
+
+  /**
+   * @brief Selects the instruction set used by the kernels, e.g. to compare
+   * implementations. Levels above GetSupportedSimdLevel() are clamped.
+   */
+  void SetSimdLevel(SimdLevel level);
+
+  /**
+   * @struct Vec3Columns
+   * @brief Component columns of a batch of 3D vectors. All spans must have
+   * the same length.
+   */
+  struct Vec3Columns
+  {
+    std::span<double> x;
+    std::span<double> y;
+    std::span<double> z;
+  };
+
+  /**
+   * @struct ConstVec3Columns
+   * @brief Read-only component columns of a batch of 3D vectors.
+   */
+  struct ConstVec3Columns
+  {
+    ConstVec3Columns(std::span<const double> x, std::span<const double> y,
+                     std::span<const double> z)
+        : x(x), y(y), z(z) {}
+    ConstVec3Columns(const Vec3Columns &columns)
+        : x(columns.x), y(columns.y), z(columns.z) {}
+
+    std::span<const double> x;
+    std::span<const double> y;
+    std::span<const double> z;
+  };
+
+  /**
+   * @struct QuatColumns
+   * @brief Component columns of a batch of quaternions. All spans must have
+   * the same length.
+   */
+  struct QuatColumns
+  {
+    std::span<double> w;
+    std::span<double> x;
+    std::span<double> y;
+    std::span<double> z;
+  };
+
+  /**
+   * @struct ConstQuatColumns
+   * @brief Read-only component columns of a batch of quaternions.
+   */
+  struct ConstQuatColumns
+  {
+    ConstQuatColumns(std::span<const double> w, std::span<const double> x,
+                     std::span<const double> y, std::span<const double> z)
+        : w(w), x(x), y(y), z(z) {}
+    ConstQuatColumns(const QuatColumns &columns)
+        : w(columns.w), x(columns.x), y(columns.y), z(columns.z) {}
+
+    std::span<const double> w;
+    std::span<const double> x;
+    std::span<const double> y;
+    std::span<const double> z;
+  };
+
+  // --- Column kernels ---
+  //
+  // All kernels throw std::invalid_argument if the column lengths differ.
+  // Outputs may alias inputs of the same component. The vector paths use
+  // the same operation order as the scalar reference and never fuse
+  // multiply-adds, so their results match it exactly unless the compiler
+  // contracts the scalar code.
+
+  /**
+   * @brief Scales every quaternion to unit length. Zero quaternions are left
+   * unchanged.
+   */
+  void NormalizeQuaternions(QuatColumns quat);
+
+  /**
+   * @brief Converts unit quaternions to euler angles (roll, pitch, yaw) in
+   * radians, using the aerospace Z-Y-X convention.
+   */
+  void QuaternionsToEuler(ConstQuatColumns quat, Vec3Columns euler);
+
+  /**
+   * @brief Rotates body-frame vectors into the world frame by unit
+   * quaternions.
+   */
+  void RotateToWorld(ConstQuatColumns quat, ConstVec3Columns body,
+                     Vec3Columns world);
+
+  /**
+   * @brief Computes the Euclidean norm of every vector.
+   */
+  void ComputeNorms(ConstVec3Columns vectors, std::span<double> norms);
+
+  /**
+   * @brief Interpolates linearly: out = from * (1 - t) + to * t, which is
+   * exact at t = 0 and t = 1.
+   */
+  void Lerp(std::span<const double> from, std::span<const double> to,
+            std::span<const double> t, std::span<double> out);
+
+  /**
+   * @brief Spherically interpolates unit quaternions along the shorter arc.
+   *
+   * t = 1 yields to exactly; other results are unit length. Nearly parallel
+   * pairs fall back to a normalized linear interpolation.
+   */
+  void Slerp(ConstQuatColumns from, ConstQuatColumns to,
+             std::span<const double> t, QuatColumns out);
+
+  // --- Frame kernels ---
+
+  /**
+   * @brief Normalizes the attitude quaternion of every frame.
+   */
+  void NormalizeQuaternions(std::span<TelemetryData> frames);
+
+  /**
+   * @brief Recomputes the euler field of every frame from its quaternion.
+   */
+  void UpdateEulerFromQuaternions(std::span<TelemetryData> frames);
+
+  /**
+   * @brief Rotates the body-frame acceleration of every frame into the world
+   * frame.
+   * @param frames Input frames.
+   * @param world Output vectors, one per frame.
+   * @throws std::invalid_argument if the sizes differ.
+   */
+  void RotateAccelerationToWorld(std::span<const TelemetryData> frames,
+                                 std::span<Vec3> world);
+
+  /**
+   * @brief Computes the Euclidean norm of every vector.
+   * @throws std::invalid_argument if the sizes differ.
+   */
+  void ComputeNorms(std::span<const Vec3> vectors, std::span<double> norms);
+
+  /**
+   * @namespace gcs::data::scalar
+   * @brief Scalar reference implementations of the column kernels, used to
+   * validate the vector paths.
+   */
+  namespace scalar
+  {
+    void NormalizeQuaternions(QuatColumns quat);
+    void QuaternionsToEuler(ConstQuatColumns quat, Vec3Columns euler);
+    void RotateToWorld(ConstQuatColumns quat, ConstVec3Columns body,
+                       Vec3Columns world);
+    void ComputeNorms(ConstVec3Columns vectors, std::span<double> norms);
+    void Lerp(std::span<const double> from, std::span<const double> to,
+              std::span<const double> t, std::span<double> out);
+    void Slerp(ConstQuatColumns from, ConstQuatColumns to,
+               std::span<const double> t, QuatColumns out);
+  } // namespace scalar
+
+} // namespace gcs::data
+
+#endif // GCS_CORE_DATA_TELEMETRY_MATH_H_
@@ -0,0 +1,118 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_DATA_TELEMETRY_RESAMPLER_H_
+#define GCS_CORE_DATA_TELEMETRY_RESAMPLER_H_
+
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "common/config.h"
+#include "common/event.h"
+#include "data/telemetry.h"
+
+namespace gcs::data
+{
+
+  /**
+   * @class TelemetryResampler
+   * @brief Resamples a jittery telemetry stream onto a fixed clock.
+   *
+   * Output frames are emitted at every multiple of the period, so streams of
+   * several vehicles resampled with the same period line up tick by tick.
+   * Each output frame interpolates the two input frames around its tick:
+   * - pos, vel, acc and euler linearly;
+   * - quat by SLERP along the shorter arc (inputs should be unit length);
+   * - fsm, sensor, ejection and the packet counters hold the last value.
+   *
+   * Euler angles are interpolated per component and do not unwrap at
+   * +-180 degrees; frames that need consistent angles can recompute them
+   * with UpdateEulerFromQuaternions().
+   *
+   * A tick is emitted once the first input frame at or after it arrives, so
+   * live output lags the input by at most one frame interval. Gaps longer
+   * than the maximum gap and steps back in time (e.g. a LogPlayer seek)
+   * restart the clock at the next frame instead of interpolating across.
+   *
+   * Works the same live and over replay:
+   * @code
+   * TelemetryResampler resampler;
+   * player->OnTelemetry.ConnectBatch(
+   *     [&resampler](std::span<const TelemetryData> frames)
+   *     { resampler.Push(frames); });
+   * resampler.OnResampled.ConnectBatch(...);
+   * @endcode
+   *
+   * TelemetryResampler is not synchronized; feed it from one thread.
+   */
+  class TelemetryResampler
+  {
+  public:
+    /**
+     * @param period Output period; clamped to at least 1 us.
+     * @param max_gap Longest input gap that is interpolated across.
+     */
+    explicit TelemetryResampler(
+        std::chrono::microseconds period =
+            gcs::common::kTelemetryResamplePeriod,
+        std::chrono::microseconds max_gap =
+            gcs::common::kTelemetryResampleMaxGap);
+
+    /**
+     * @brief Resamples a run of input frames.
+     * @param frames Input frames in timestamp order; continues the stream of
+     * previous calls.
+     * @param out The frames of every tick that became due are appended.
+     */
+    void Process(std::span<const TelemetryData> frames,
+                 std::vector<TelemetryData> &out);
+
+    /**
+     * @brief Resamples a run of input frames and emits the due frames through
+     * OnResampled in a single batch.
+     */
+    void Push(std::span<const TelemetryData> frames);
+
+    /**
+     * @brief Forgets the stream; the next frame restarts the clock.
+     */
+    void Reset();
+
+    std::chrono::microseconds GetPeriod() const
+    {
+      return std::chrono::microseconds(period_us_);
+    }
+
+    /**
+     * @brief Emits the frames produced by Push(), one run per call.
+     */
+    gcs::common::BatchSignal<TelemetryData> OnResampled;
+
+  private:
+    // An output tick and the input frames around it.
+    struct Tick
+    {
+      const TelemetryData *from;
+      const TelemetryData *to;
+      std::uint64_t timestamp_us;
+      double t; // Position of the tick between from (0) and to (1).
+    };
+
+    // Fills out[first..] from ticks_ with the column kernels.
+    void Interpolate(std::vector<TelemetryData> &out, std::size_t first);
+
+    std::uint64_t period_us_;
+    std::uint64_t max_gap_us_;
+    bool has_last_ = false;
+    TelemetryData last_;
+    std::uint64_t next_tick_us_ = 0;
+    std::vector<Tick> ticks_;
+    std::vector<TelemetryData> output_;
+  };
+
+} // namespace gcs::data
+
+#endif // GCS_CORE_DATA_TELEMETRY_RESAMPLER_H_
@@ -0,0 +1,282 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_DATA_TELEMETRY_STATS_H_
+#define GCS_CORE_DATA_TELEMETRY_STATS_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "common/config.h"
+#include "data/telemetry.h"
+#include "data/telemetry_channel.h"
+
+namespace gcs::data
+{
+
+  /**
+   * @class TDigest
+   * @brief Mergeable sketch of a value distribution for percentiles and
+   * histograms (merging t-digest).
+   *
+   * Values are buffered and folded into at most about 2 * compression
+   * weighted centroids whenever the buffer fills, so Add() is amortized
+   * constant time and memory stays bounded for any number of values.
+   * Centroids near the tails are kept small, which makes extreme
+   * percentiles (p1, p99) accurate to a few parts per thousand.
+   */
+  class TDigest
+  {
+  public:
+    /**
+     * @param compression Accuracy/size trade-off.
+     */
+    explicit TDigest(
+        double compression = gcs::common::kTelemetryStatsCompression);
+
+    /**
+     * @brief Adds a value. NaN values are ignored.
+     */
+    void Add(double value);
+
+    /**
+     * @brief Adds the values of another digest, e.g. one computed over
+     * another log segment.
+     */
+    void Merge(const TDigest &other);
+
+    /**
+     * @brief Discards all values.
+     */
+    void Reset();
+
+    /**
+     * @brief Number of values added.
+     */
+    std::uint64_t GetCount() const { return count_; }
+
+    /**
+     * @brief Estimates the value below which a fraction q of the values
+     * lies.
+     * @param q Fraction in [0, 1]; 0 and 1 give the exact extremes.
+     * @return NaN if the digest is empty.
+     */
+    double Quantile(double q) const;
+
+    /**
+     * @brief Estimates the fraction of values below x.
+     * @return NaN if the digest is empty.
+     */
+    double Cdf(double x) const;
+
+    /**
+     * @brief Estimates the number of values in each of bins equal-width
+     * bins over [lo, hi).
+     * @param counts Replaced by bins counts.
+     */
+    void Histogram(double lo, double hi, std::size_t bins,
+                   std::vector<double> &counts) const;
+
+  private:
+    struct Centroid
+    {
+      double mean;
+      double weight;
+    };
+
+    // Folds buffer_ into centroids_. Queries are const but compress first,
+    // hence the mutable members.
+    void Compress() const;
+
+    double compression_;
+    std::size_t buffer_limit_;
+    std::uint64_t count_ = 0;
+    double min_;
+    double max_;
+    mutable std::vector<Centroid> centroids_;
+    mutable std::vector<Centroid> buffer_;
+  };
+
+  /**
+   * @class ChannelStats
+   * @brief Running statistics of one channel.
+   *
+   * Mean and variance use Welford's update, which stays accurate over long
+   * flights where summing squares would cancel. NaN samples are ignored.
+   */
+  class ChannelStats
+  {
+  public:
+    /**
+     * @brief Adds one sample.
+     * @param value Sample value.
+     * @param timestamp Timestamp of the sample's frame (us).
+     */
+    void Add(double value, std::uint64_t timestamp);
+
+    /**
+     * @brief Adds the samples of another aggregate. Extremes that tie keep
+     * the earlier timestamp.
+     */
+    void Merge(const ChannelStats &other);
+
+    /**
+     * @brief Discards all samples.
+     */
+    void Reset();
+
+    std::uint64_t GetCount() const { return count_; }
+
+    /**
+     * @brief Smallest sample, or NaN if there is none.
+     */
+    double GetMin() const { return min_; }
+
+    /**
+     * @brief Timestamp of the first occurrence of GetMin().
+     */
+    std::uint64_t GetMinTimestamp() const { return min_timestamp_; }
+
+    /**
+     * @brief Largest sample, or NaN if there is none.
+     */
+    double GetMax() const { return max_; }
+
+    /**
+     * @brief Timestamp of the first occurrence of GetMax().
+     */
+    std::uint64_t GetMaxTimestamp() const { return max_timestamp_; }
+
+    /**
+     * @brief Mean, or NaN if there is no sample.
+     */
+    double GetMean() const;
+
+    /**
+     * @brief Sample variance, or NaN if there are fewer than two samples.
+     */
+    double GetVariance() const;
+
+    /**
+     * @brief Square root of GetVariance().
+     */
+    double GetStdDev() const;
+
+    /**
+     * @brief Estimated percentile.
+     * @see TDigest::Quantile()
+     */
+    double GetQuantile(double q) const { return digest_.Quantile(q); }
+
+    /**
+     * @brief Distribution sketch, for histograms and CDFs.
+     */
+    const TDigest &GetDigest() const { return digest_; }
+
+  private:
+    std::uint64_t count_ = 0;
+    double mean_ = 0.0;
+    double m2_ = 0.0; // Sum of squared deviations from the mean.
+    double min_ = std::numeric_limits<double>::quiet_NaN();
+    double max_ = std::numeric_limits<double>::quiet_NaN();
+    std::uint64_t min_timestamp_ = 0;
+    std::uint64_t max_timestamp_ = 0;
+    TDigest digest_;
+  };
+
+  /**
+   * @class TelemetryStats
+   * @brief Running statistics of every channel of a telemetry stream.
+   *
+   * Each frame updates all aggregates in constant time, so a dashboard can
+   * show flight statistics live instead of re-reading the log afterwards.
+   * Besides the channels of TelemetryChannel, the acceleration norm and the
+   * speed are tracked; the peak altitude is the extreme of the position
+   * channel pointing up in the vehicle's frame convention.
+   *
+   * Attach to a converter or a LogPlayer with a single BatchSignal
+   * connection:
+   * @code
+   * converter->OnTelemetryConverted.ConnectBatch(
+   *     [&stats](std::span<const TelemetryData> frames)
+   *     { stats.Add(frames); });
+   * @endcode
+   *
+   * Aggregates of separate log segments, e.g. computed on a thread pool,
+   * combine with Merge(); the result does not depend on how the log was
+   * split, except for percentile estimates within their error bound.
+   *
+   * TelemetryStats is not synchronized; readers on another thread must
+   * share a lock with the listener.
+   */
+  class TelemetryStats
+  {
+  public:
+    /**
+     * @brief Adds one frame.
+     */
+    void Add(const TelemetryData &frame);
+
+    /**
+     * @brief Adds a run of frames.
+     */
+    void Add(std::span<const TelemetryData> frames);
+
+    /**
+     * @brief Adds the frames of another aggregate.
+     */
+    void Merge(const TelemetryStats &other);
+
+    /**
+     * @brief Discards all frames.
+     */
+    void Reset();
+
+    std::uint64_t GetFrameCount() const { return frame_count_; }
+
+    /**
+     * @brief Smallest frame timestamp (us), or 0 if there is no frame.
+     */
+    std::uint64_t GetFirstTimestamp() const { return first_timestamp_; }
+
+    /**
+     * @brief Largest frame timestamp (us), or 0 if there is no frame.
+     */
+    std::uint64_t GetLastTimestamp() const { return last_timestamp_; }
+
+    /**
+     * @brief Statistics of one channel.
+     * @param channel Must not be TelemetryChannel::kCount.
+     */
+    const ChannelStats &Get(TelemetryChannel channel) const
+    {
+      return channels_[static_cast<std::size_t>(channel)];
+    }
+
+    /**
+     * @brief Statistics of the acceleration norm |acc|.
+     */
+    const ChannelStats &GetAccelerationNorm() const { return acc_norm_; }
+
+    /**
+     * @brief Statistics of the speed |vel|.
+     */
+    const ChannelStats &GetSpeed() const { return speed_; }
+
+  private:
+    std::uint64_t frame_count_ = 0;
+    std::uint64_t first_timestamp_ = 0;
+    std::uint64_t last_timestamp_ = 0;
+    std::array<ChannelStats, kTelemetryChannelCount> channels_;
+    ChannelStats acc_norm_;
+    ChannelStats speed_;
+  };
+
+} // namespace gcs::data
+
+#endif // GCS_CORE_DATA_TELEMETRY_STATS_H_
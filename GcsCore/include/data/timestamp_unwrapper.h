@@ -0,0 +1,60 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_DATA_TIMESTAMP_UNWRAPPER_H_
+#define GCS_CORE_DATA_TIMESTAMP_UNWRAPPER_H_
+
+#include <cstdint>
+
+namespace gcs::data
+{
+
+  /**
+   * @class TimestampUnwrapper
+   * @brief Extends a wrapping device counter to a 64-bit count.
+   *
+   * Device clocks are often 32-bit tick counters; a millisecond counter
+   * wraps after about 49.7 days and a microsecond counter after 71.6
+   * minutes. Each raw value is placed at the position nearest to the
+   * previous one modulo 2^bits, so steps shorter than half the range are
+   * followed in either direction and wraps are absorbed. Longer jumps, such
+   * as a device reboot, cannot be told apart from wraps; call Reset() when
+   * the device reports one.
+   *
+   * @code
+   * TimestampUnwrapper unwrapper;
+   * frame.timestamp_us = unwrapper.Unwrap(packet.uptime_ms) * 1000;
+   * @endcode
+   */
+  class TimestampUnwrapper
+  {
+  public:
+    /**
+     * @param bits Width of the raw counter, 1 to 63.
+     */
+    explicit TimestampUnwrapper(unsigned bits = 32);
+
+    /**
+     * @brief Extends one raw counter value.
+     * @param raw Counter value; bits above the counter width are ignored.
+     * @return The unwrapped count. The first value is returned as is;
+     * steps back past zero clamp to zero.
+     */
+    std::uint64_t Unwrap(std::uint64_t raw);
+
+    /**
+     * @brief Forgets the history, e.g. after the device restarted.
+     */
+    void Reset();
+
+  private:
+    std::uint64_t mask_;
+    std::uint64_t last_raw_ = 0;
+    std::uint64_t extended_ = 0;
+    bool has_last_ = false;
+  };
+
+} // namespace gcs::data
+
+#endif // GCS_CORE_DATA_TIMESTAMP_UNWRAPPER_H_
@@ -45,8 +45,11 @@ namespace gcs::interfaces
 
     /**
      * @brief Event that occurs when conversion to telemetry data is complete.
+     *
+     * Converters that produce several frames at once should emit them with
+     * InvokeBatch so that batch listeners receive the run in one call.
      */
-    gcs::common::Signal<const gcs::data::TelemetryData &> OnTelemetryConverted;
+    gcs::common::BatchSignal<gcs::data::TelemetryData> OnTelemetryConverted;
   };
 
 } // namespace gcs::interfaces
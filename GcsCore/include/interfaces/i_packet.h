@@ -5,7 +5,12 @@
 #ifndef GCS_CORE_INTERFACES_I_PACKET_H_
 #define GCS_CORE_INTERFACES_I_PACKET_H_
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <exception>
+#include <span>
+#include <stdexcept>
 #include <vector>
 
 namespace gcs::interfaces
@@ -16,23 +21,84 @@ namespace gcs::interfaces
    * @brief Communication packet interface.
    *
    * Base interface that all protocol packet classes must implement.
+   * A packet overrides either the span methods (SerializedSize, SerializeTo,
+   * DeserializeFrom) or the vector methods (Serialize, Deserialize); each
+   * pair has a default implementation in terms of the other. Overriding
+   * neither recurses without end.
    */
   class IPacket
   {
   public:
     virtual ~IPacket() = default;
 
+    /**
+     * @brief Returns the number of bytes SerializeTo() writes.
+     */
+    virtual std::size_t SerializedSize() const { return Serialize().size(); }
+
+    /**
+     * @brief Serializes packet data into a caller-provided buffer, e.g. a
+     * reused uplink frame buffer, without allocating.
+     * @param buffer Destination; at least SerializedSize() bytes.
+     * @return Bytes written, or 0 if the buffer is too small.
+     *
+     * The default implementation copies the result of Serialize(), so it
+     * allocates.
+     */
+    virtual std::size_t SerializeTo(std::span<std::uint8_t> buffer) const
+    {
+      std::vector<std::uint8_t> data = Serialize();
+      if (buffer.size() < data.size())
+        return 0;
+      std::copy(data.begin(), data.end(), buffer.begin());
+      return data.size();
+    }
+
+    /**
+     * @brief Deserializes byte data into the packet object without copying,
+     * e.g. straight from a slice of a receive ring buffer.
+     * @param data Raw byte data.
+     * @return false if the data is too short or malformed.
+     *
+     * The default implementation copies the data into a vector for
+     * Deserialize() and returns false if that throws.
+     */
+    virtual bool DeserializeFrom(std::span<const std::uint8_t> data)
+    {
+      try
+      {
+        Deserialize(std::vector<std::uint8_t>(data.begin(), data.end()));
+      }
+      catch (const std::exception &)
+      {
+        return false;
+      }
+      return true;
+    }
+
     /**
      * @brief Serializes packet data into a byte vector.
      * @return Serialized byte data.
      */
-    virtual std::vector<std::uint8_t> Serialize() const = 0;
+    virtual std::vector<std::uint8_t> Serialize() const
+    {
+      std::vector<std::uint8_t> data(SerializedSize());
+      data.resize(SerializeTo(data));
+      return data;
+    }
 
     /**
      * @brief Deserializes byte data into the packet object.
      * @param data Raw byte data.
+     * @throws std::invalid_argument if DeserializeFrom() rejects the data.
      */
-    virtual void Deserialize(const std::vector<std::uint8_t> &data) = 0;
+    virtual void Deserialize(const std::vector<std::uint8_t> &data)
+    {
+      if (!DeserializeFrom(data))
+      {
+        throw std::invalid_argument("Malformed packet data");
+      }
+    }
 
     /**
      * @brief Returns the unique ID of the packet.
@@ -7,10 +7,9 @@
 
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <vector>
 
-#include <winrt/Windows.Foundation.h>
-
 #include "common/event.h"
 
 namespace gcs::interfaces
@@ -32,12 +31,15 @@ namespace gcs::interfaces
 
     /**
      * @brief Injects received byte data into the parser.
-     * @param data Byte array view to process (passed without copying).
+     * @param data Bytes to process, passed without copying. The view is only
+     * valid for the duration of the call, so it may point into a reused
+     * read buffer, a ring buffer or a memory-mapped file. WinRT buffers are
+     * adapted with gcs::transport::AsSpan().
      *
      * Accumulates data in an internal buffer and attempts to complete packets.
      * When a packet is completed, the OnPacketReceived event occurs.
      */
-    virtual void PushData(winrt::array_view<std::uint8_t const> data) = 0;
+    virtual void PushData(std::span<const std::uint8_t> data) = 0;
 
     /**
      * @brief Initializes the internal state of the parser.
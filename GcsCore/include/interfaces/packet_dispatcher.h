@@ -0,0 +1,103 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_INTERFACES_PACKET_DISPATCHER_H_
+#define GCS_CORE_INTERFACES_PACKET_DISPATCHER_H_
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+#include "interfaces/i_packet.h"
+#include "interfaces/packet_factory.h"
+
+namespace gcs::interfaces
+{
+
+  namespace detail
+  {
+    template <typename T, typename Visitor>
+    void VisitPacket(const IPacket &packet, Visitor &visitor)
+    {
+      assert(dynamic_cast<const T *>(&packet) != nullptr &&
+             "Packet ID does not match its type");
+      visitor(static_cast<const T &>(packet));
+    }
+
+    template <typename Visitor>
+    using PacketVisitThunk = void (*)(const IPacket &, Visitor &);
+
+    template <typename Visitor, std::size_t Size, typename... Entries>
+    constexpr std::array<PacketVisitThunk<Visitor>, Size> BuildVisitTable()
+    {
+      std::array<PacketVisitThunk<Visitor>, Size> table{};
+      ((table[static_cast<std::size_t>(Entries::kId)] =
+            &VisitPacket<typename Entries::Type, Visitor>),
+       ...);
+      return table;
+    }
+  } // namespace detail
+
+  /**
+   * @class PacketDispatcher
+   * @brief Calls a visitor with the concrete type of a packet, found through
+   * a jump table indexed by packet ID.
+   * @tparam Entries PacketEntry list, e.g. the one of a StaticPacketRegistry.
+   *
+   * A dispatch costs one GetId() call and one indirect call, however many
+   * types are listed, and neither uses RTTI nor touches reference counts,
+   * unlike a chain of std::dynamic_pointer_cast. The visitor must accept
+   * every listed type, so a converter that forgets a type fails to compile.
+   * Each packet's GetId() must match the ID its type is listed under;
+   * debug builds assert this.
+   *
+   * @code
+   * using Packets = gcs::interfaces::PacketDispatcher<
+   *     gcs::interfaces::PacketEntry<0x01, ImuPacket>,
+   *     gcs::interfaces::PacketEntry<0x02, GpsPacket>>;
+   *
+   * void MyConverter::Convert(const std::shared_ptr<IPacket> &packet)
+   * {
+   *   Packets::Dispatch(*packet, [this](const auto &typed)
+   *                     { Handle(typed); }); // Handle() overloads per type.
+   * }
+   * @endcode
+   */
+  template <typename... Entries>
+  class PacketDispatcher
+  {
+  public:
+    static constexpr std::size_t kTableSize =
+        detail::PacketIdTable<Entries...>::kSize;
+
+    /**
+     * @brief Calls visitor(const T &) for the concrete type T of packet.
+     * @return false if the packet's ID is not listed.
+     */
+    template <typename Visitor>
+    static bool Dispatch(const IPacket &packet, Visitor &&visitor)
+    {
+      using V = std::remove_reference_t<Visitor>;
+      int id = packet.GetId();
+      if (id < 0 || static_cast<std::size_t>(id) >= kTableSize)
+        return false;
+      detail::PacketVisitThunk<V> thunk =
+          kVisitTable<V>[static_cast<std::size_t>(id)];
+      if (thunk == nullptr)
+        return false;
+      thunk(packet, visitor);
+      return true;
+    }
+
+  private:
+    template <typename Visitor>
+    static constexpr std::array<detail::PacketVisitThunk<Visitor>, kTableSize>
+        kVisitTable =
+            detail::BuildVisitTable<Visitor, kTableSize, Entries...>();
+  };
+
+} // namespace gcs::interfaces
+
+#endif // GCS_CORE_INTERFACES_PACKET_DISPATCHER_H_
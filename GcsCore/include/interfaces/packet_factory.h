@@ -5,71 +5,313 @@
 #ifndef GCS_CORE_INTERFACES_PACKET_FACTORY_H_
 #define GCS_CORE_INTERFACES_PACKET_FACTORY_H_
 
-#include <functional>
-#include <map>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
+#include "common/config.h"
 #include "interfaces/i_packet.h"
+#include "interfaces/packet_pool.h"
 
 namespace gcs::interfaces
 {
 
+  /**
+   * @brief Function creating a packet of one type.
+   */
+  using PacketCreator = std::shared_ptr<IPacket> (*)();
+
+  /**
+   * @brief PacketCreator of packet type T, drawing from its PacketPool.
+   */
+  template <typename T>
+  std::shared_ptr<IPacket> CreatePooledPacket()
+  {
+    return PacketPool<T>::Make();
+  }
+
   /**
    * @class PacketFactory
    * @brief Factory for creating IPacket instances based on ID.
+   *
+   * Packets are drawn from the PacketPool of their type, so their memory is
+   * reused once every holder has released them.
+   *
+   * IDs below kPacketFactoryDenseIds resolve through a flat table with a
+   * single atomic load; other IDs fall back to a hash map. Register all
+   * types at startup, as REGISTER_PACKET does: lookups take no lock, so
+   * sparse IDs must not be registered while other threads create packets.
+   * When the packet set is known at compile time, StaticPacketRegistry
+   * avoids the registry altogether.
    */
   class PacketFactory
   {
   public:
-    using Creator = std::function<std::shared_ptr<IPacket>()>;
+    using Creator = PacketCreator;
 
     /**
      * @brief Registers a packet type with its ID.
      * @tparam T Packet class type.
      * @param id Unique ID for the packet type.
+     * @return false if another type is already registered under id.
      */
     template <typename T>
-    static void Register(int id)
+    static bool Register(int id)
+    {
+      return Register(id, &CreatePooledPacket<T>);
+    }
+
+    /**
+     * @brief Registers a creator function with an ID.
+     *
+     * Registration usually runs during static initialization, where an
+     * exception would terminate the program before main, so a duplicate ID
+     * is logged as an error and the first registration is kept. Registering
+     * the same creator again has no effect.
+     *
+     * @return false if another creator is already registered under id.
+     */
+    static bool Register(int id, Creator creator)
     {
-      GetRegistry()[id] = []()
-      { return std::make_shared<T>(); };
+      Registry &registry = GetRegistry();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      Creator existing = Find(registry, id);
+      if (existing != nullptr)
+      {
+        if (existing != creator)
+        {
+          ReportDuplicate(id);
+          return false;
+        }
+        return true;
+      }
+      if (IsDense(id))
+      {
+        registry.dense[static_cast<std::size_t>(id)].store(
+            creator, std::memory_order_release);
+      }
+      else
+      {
+        registry.sparse[id] = creator;
+      }
+      return true;
     }
 
     /**
      * @brief Creates a packet instance based on ID.
      * @param id Packet ID.
-     * @return Shared pointer to the created packet, or nullptr if not registered.
+     * @return Shared pointer to a pooled packet, or nullptr if not registered.
      */
     static std::shared_ptr<IPacket> Create(int id)
     {
-      auto &registry = GetRegistry();
-      auto it = registry.find(id);
-      if (it != registry.end())
+      Creator creator = Find(GetRegistry(), id);
+      return creator != nullptr ? creator() : nullptr;
+    }
+
+    /**
+     * @brief Checks whether a packet type is registered under id.
+     */
+    static bool IsRegistered(int id)
+    {
+      return Find(GetRegistry(), id) != nullptr;
+    }
+
+  private:
+    struct Registry
+    {
+      std::array<std::atomic<Creator>, gcs::common::kPacketFactoryDenseIds>
+          dense{};
+      std::unordered_map<int, Creator> sparse;
+      std::mutex mutex; // Serializes registration.
+    };
+
+    // Logs a rejected duplicate registration.
+    static void ReportDuplicate(int id);
+
+    static bool IsDense(int id)
+    {
+      return id >= 0 &&
+             static_cast<std::size_t>(id) < gcs::common::kPacketFactoryDenseIds;
+    }
+
+    static Creator Find(Registry &registry, int id)
+    {
+      if (IsDense(id))
       {
-        return it->second();
+        return registry.dense[static_cast<std::size_t>(id)].load(
+            std::memory_order_acquire);
       }
-      return nullptr;
+      auto it = registry.sparse.find(id);
+      return it != registry.sparse.end() ? it->second : nullptr;
     }
 
-  private:
     // Meyers' Singleton to hold the registry
-    static std::map<int, Creator> &GetRegistry()
+    static Registry &GetRegistry()
     {
-      static std::map<int, Creator> registry;
+      static Registry registry;
       return registry;
     }
   };
 
   /**
    * @brief Helper for automatic packet registration.
+   *
+   * A duplicate ID asserts in debug builds; release builds log it and keep
+   * the first registration.
    */
   template <typename T>
   struct PacketRegistrar
   {
     PacketRegistrar(int id)
     {
-      PacketFactory::Register<T>(id);
+      [[maybe_unused]] bool registered = PacketFactory::Register<T>(id);
+      assert(registered && "Duplicate packet ID in REGISTER_PACKET");
+    }
+  };
+
+  /**
+   * @struct PacketEntry
+   * @brief Binds a packet type to its ID in a StaticPacketRegistry.
+   */
+  template <int Id, typename T>
+  struct PacketEntry
+  {
+    static constexpr int kId = Id;
+    using Type = T;
+  };
+
+  namespace detail
+  {
+    template <std::size_t N>
+    constexpr bool HasDuplicatePacketIds(const std::array<int, N> &ids)
+    {
+      for (std::size_t i = 0; i < N; ++i)
+      {
+        for (std::size_t j = i + 1; j < N; ++j)
+        {
+          if (ids[i] == ids[j])
+            return true;
+        }
+      }
+      return false;
+    }
+
+    template <std::size_t N>
+    constexpr int MaxPacketId(const std::array<int, N> &ids)
+    {
+      int max_id = ids[0];
+      for (int id : ids)
+      {
+        max_id = id > max_id ? id : max_id;
+      }
+      return max_id;
+    }
+
+    /**
+     * @brief Validates a list of PacketEntry and sizes the table indexed by
+     * its IDs. Duplicate, negative or very large IDs fail to compile.
+     */
+    template <typename... Entries>
+    struct PacketIdTable
+    {
+      static_assert(sizeof...(Entries) > 0, "Packet list is empty");
+      static_assert(((Entries::kId >= 0) && ...),
+                    "Packet IDs in a static list must not be negative");
+
+      static constexpr std::array<int, sizeof...(Entries)> kIds = {
+          Entries::kId...};
+      static_assert(!HasDuplicatePacketIds(kIds),
+                    "Duplicate packet ID in a static packet list");
+      static_assert(MaxPacketId(kIds) < 65536,
+                    "Packet IDs in a static list must be small; use "
+                    "PacketFactory for sparse IDs");
+
+      static constexpr std::size_t kSize =
+          static_cast<std::size_t>(MaxPacketId(kIds)) + 1;
+    };
+
+    template <std::size_t Size, typename... Entries>
+    constexpr std::array<PacketCreator, Size> BuildPacketTable()
+    {
+      std::array<PacketCreator, Size> table{};
+      ((table[static_cast<std::size_t>(Entries::kId)] =
+            &CreatePooledPacket<typename Entries::Type>),
+       ...);
+      return table;
+    }
+
+    template <std::size_t Size, typename... Entries>
+    constexpr std::array<bool, Size> BuildPacketPresence()
+    {
+      std::array<bool, Size> present{};
+      ((present[static_cast<std::size_t>(Entries::kId)] = true), ...);
+      return present;
+    }
+  } // namespace detail
+
+  /**
+   * @class StaticPacketRegistry
+   * @brief Packet factory fixed at compile time from a list of PacketEntry.
+   *
+   * The creators are laid out in a constexpr table indexed by ID, so Create()
+   * is one bounds check and one indirect call, with no registration order or
+   * locking to consider. Duplicate or negative IDs fail to compile.
+   *
+   * @code
+   * using Packets = gcs::interfaces::StaticPacketRegistry<
+   *     gcs::interfaces::PacketEntry<0x01, ImuPacket>,
+   *     gcs::interfaces::PacketEntry<0x02, GpsPacket>>;
+   * auto packet = Packets::Create(id);
+   * @endcode
+   */
+  template <typename... Entries>
+  class StaticPacketRegistry
+  {
+  public:
+    static constexpr std::size_t kTableSize =
+        detail::PacketIdTable<Entries...>::kSize;
+
+    /**
+     * @brief Creates a packet instance based on ID.
+     * @return Shared pointer to a pooled packet, or nullptr if id is not in
+     * the list.
+     */
+    static std::shared_ptr<IPacket> Create(int id)
+    {
+      if (id < 0 || static_cast<std::size_t>(id) >= kTableSize)
+        return nullptr;
+      PacketCreator creator = kTable[static_cast<std::size_t>(id)];
+      return creator != nullptr ? creator() : nullptr;
+    }
+
+    /**
+     * @brief Checks whether id is in the list.
+     */
+    static constexpr bool Contains(int id)
+    {
+      return id >= 0 && static_cast<std::size_t>(id) < kTableSize &&
+             kPresent[static_cast<std::size_t>(id)];
     }
+
+    /**
+     * @brief Adds every entry to the runtime PacketFactory, e.g. for code
+     * that still creates packets through it.
+     */
+    static void RegisterAll()
+    {
+      (PacketFactory::Register<typename Entries::Type>(Entries::kId), ...);
+    }
+
+  private:
+    static constexpr std::array<PacketCreator, kTableSize> kTable =
+        detail::BuildPacketTable<kTableSize, Entries...>();
+    // Function addresses cannot be compared in all constant expressions.
+    static constexpr std::array<bool, kTableSize> kPresent =
+        detail::BuildPacketPresence<kTableSize, Entries...>();
   };
 
 } // namespace gcs::interfaces
@@ -0,0 +1,62 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_INTERFACES_PACKET_POOL_H_
+#define GCS_CORE_INTERFACES_PACKET_POOL_H_
+
+#include <memory>
+#include <type_traits>
+
+#include "common/block_pool.h"
+#include "interfaces/i_packet.h"
+
+namespace gcs::interfaces
+{
+
+  /**
+   * @class PacketPool
+   * @brief Recycles the memory of packets of one type.
+   * @tparam T Packet class type.
+   *
+   * Make() places the packet and its shared_ptr reference counts in one
+   * pooled block, which returns to the pool when the last listener drops
+   * the packet. Once the pool covers the peak number of packets in flight,
+   * creating packets no longer touches the heap. Each packet is still
+   * freshly constructed, so no state leaks from a previous use.
+   *
+   * Parsers that construct concrete packets directly use it in place of
+   * std::make_shared:
+   * @code
+   * auto packet = gcs::interfaces::PacketPool<MyPacket>::Make();
+   * @endcode
+   */
+  template <typename T>
+  class PacketPool
+  {
+    static_assert(std::is_base_of_v<IPacket, T>,
+                  "PacketPool requires an IPacket type");
+
+  public:
+    /**
+     * @brief Creates a value-initialized packet in a recycled block.
+     */
+    static std::shared_ptr<T> Make()
+    {
+      return std::allocate_shared<T>(gcs::common::PoolAllocator<T>(GetPool()));
+    }
+
+    /**
+     * @brief The block pool of this packet type, e.g. to inspect its counters.
+     */
+    static gcs::common::BlockPool &GetPool()
+    {
+      // Never destroyed: packets may be released during static destruction.
+      static auto *pool = new gcs::common::BlockPool();
+      return *pool;
+    }
+  };
+
+} // namespace gcs::interfaces
+
+#endif // GCS_CORE_INTERFACES_PACKET_POOL_H_
@@ -9,8 +9,11 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "common/event.h"
+#include "logging/log_pyramid.h"
+#include "logging/parsed_log_format.h"
 
 namespace gcs::interfaces
 {
@@ -29,6 +32,10 @@ namespace gcs::logging
   /**
    * @class BinaryLogWriter
    * @brief Handles recording of raw and parsed data to binary files.
+   *
+   * Next to each parsed log a LogPyramid sidecar (.pyr) is written as the
+   * recording grows, so the log can be browsed at any zoom right away.
+   * Both files are flushed whenever a pyramid leaf completes.
    */
   class BinaryLogWriter
   {
@@ -38,10 +45,12 @@ namespace gcs::logging
      * @param parser Protocol parser (ownership transferred).
      * @param converter Data converter (ownership transferred).
      * @param log_dir Directory to store log files.
+     * @param encoding Storage of the floating-point channels in parsed logs.
      */
     BinaryLogWriter(std::unique_ptr<gcs::interfaces::IParser> parser,
                     std::unique_ptr<gcs::interfaces::IConverter> converter,
-                    const std::string &log_dir);
+                    const std::string &log_dir,
+                    ParsedLogEncoding encoding = ParsedLogEncoding::kFloat64);
 
     /**
      * @brief Destructor.
@@ -51,8 +60,12 @@ namespace gcs::logging
     /**
      * @brief Binds the writer to a SerialManager.
      * @param serial SerialManager to monitor.
+     * @param raw_queue If an executor is set, raw data is logged and parsed on
+     * that executor instead of the serial read loop. Use
+     * OverflowPolicy::kBlock if no chunk may be lost.
      */
-    void Bind(gcs::transport::SerialManager &serial);
+    void Bind(gcs::transport::SerialManager &serial,
+              gcs::common::QueueOptions raw_queue = {});
 
     /**
      * @brief Starts the logging process. Creates new log files.
@@ -78,6 +91,10 @@ namespace gcs::logging
     std::string log_dir_;
     std::ofstream raw_file_;
     std::ofstream parsed_file_;
+    ParsedLogSchema parsed_schema_;
+    std::vector<std::uint8_t> parsed_records_;
+    std::ofstream pyramid_file_;
+    LogPyramidBuilder pyramid_;
 
     std::unique_ptr<gcs::interfaces::IParser> parser_;
     std::unique_ptr<gcs::interfaces::IConverter> converter_;
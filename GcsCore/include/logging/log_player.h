@@ -6,20 +6,21 @@
 #define GCS_CORE_LOGGING_LOG_PLAYER_H_
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <fstream>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <span>
 #include <string>
 #include <thread>
 #include <vector>
 
 #include "common/event.h"
-
-namespace gcs::data
-{
-  struct TelemetryData;
-} // namespace gcs::data
+#include "data/telemetry.h"
+#include "data/timestamp_unwrapper.h"
+#include "logging/parsed_log_format.h"
 
 namespace gcs::interfaces
 {
@@ -38,7 +39,7 @@ namespace gcs::logging
   enum class LogType
   {
     kRaw,   ///< Raw binary stream (.bin)
-    kParsed ///< Pre-parsed telemetry structures (.dat)
+    kParsed ///< Pre-parsed telemetry records (.dat), versioned or legacy
   };
 
   /**
@@ -110,8 +111,11 @@ namespace gcs::logging
 
     /**
      * @brief Event fired when telemetry data is recovered.
+     *
+     * Frames that are due without an intermediate wait are delivered as one
+     * batch to listeners registered with ConnectBatch.
      */
-    gcs::common::Signal<const gcs::data::TelemetryData &> OnTelemetry;
+    gcs::common::BatchSignal<gcs::data::TelemetryData> OnTelemetry;
 
     /**
      * @brief Event fired when CRC fails (raw mode).
@@ -127,7 +131,11 @@ namespace gcs::logging
     void PlayLoop();
     bool HandleRawChunk();
     bool HandleParsedFrame();
-    void SyncTiming(std::uint32_t timestamp);
+    bool LoadParsedHeader();
+    void EmitTimed(std::span<const gcs::data::TelemetryData> frames);
+    std::chrono::steady_clock::time_point NextDueTime(
+        std::uint64_t timestamp_us);
+    bool WaitWhilePaused();
 
     std::unique_ptr<gcs::interfaces::IParser> parser_;
     std::unique_ptr<gcs::interfaces::IConverter> converter_;
@@ -145,7 +153,28 @@ namespace gcs::logging
     std::atomic<double> speed_ = 1.0;
     std::mutex file_mutex_;
 
-    std::uint32_t last_pkt_timestamp_ = 0;
+    // Replay clock: frames are due at anchor_time_ plus their distance from
+    // anchor_timestamp_us_ divided by the speed. Re-anchored on start,
+    // seek, pause, speed change and timestamp gaps.
+    std::chrono::steady_clock::time_point anchor_time_;
+    std::uint64_t anchor_timestamp_us_ = 0;
+    std::uint64_t last_timestamp_us_ = 0;
+    std::atomic<bool> reanchor_ = true;
+    std::vector<gcs::data::TelemetryData> parsed_batch_;
+
+    // Layout of a versioned parsed log; empty for legacy struct dumps.
+    std::optional<ParsedLogSchema> parsed_schema_;
+    size_t data_offset_ = 0;
+    size_t record_size_ = sizeof(LegacyTelemetryData);
+    std::vector<std::uint8_t> parsed_bytes_;
+
+    // Extends the 32-bit millisecond timestamps of legacy and version 1
+    // logs. Reset on load, stop and seek, so timestamps after a seek start
+    // from the raw counter again.
+    gcs::data::TimestampUnwrapper timestamp_unwrapper_;
+
+    // Read buffer of raw logs, reused for every chunk.
+    std::vector<std::uint8_t> raw_chunk_;
 
     gcs::common::SignalToken on_packet_;
     gcs::common::SignalToken on_crc_fail_;
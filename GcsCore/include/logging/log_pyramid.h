@@ -0,0 +1,260 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_LOGGING_LOG_PYRAMID_H_
+#define GCS_CORE_LOGGING_LOG_PYRAMID_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "common/delegate.h"
+#include "common/executor.h"
+#include "data/telemetry.h"
+#include "data/telemetry_channel.h"
+
+namespace gcs::logging
+{
+
+  /**
+   * @brief Magic bytes at the start of a log pyramid sidecar (.pyr).
+   */
+  inline constexpr std::array<std::uint8_t, 8> kLogPyramidMagic = {
+      'G', 'C', 'S', 'P', 'Y', 'R', 'M', 'D'};
+
+  /**
+   * @brief Log pyramid format version this build reads and writes. Sidecars
+   * of other versions are rebuilt from the log.
+   */
+  inline constexpr std::uint16_t kLogPyramidVersion = 2;
+
+  /**
+   * @struct PyramidChannelSummary
+   * @brief Summary of one channel over the frames of a pyramid node. NaN
+   * samples are ignored; all fields are NaN if every sample was NaN.
+   */
+  struct PyramidChannelSummary
+  {
+    double min;
+    double max;
+    double mean;
+  };
+
+  /**
+   * @struct PyramidNode
+   * @brief Summary of 2^(leaf_shift + level) consecutive frames.
+   */
+  struct PyramidNode
+  {
+    std::uint64_t first_timestamp_us = 0;
+    std::uint64_t last_timestamp_us = 0;
+    std::array<PyramidChannelSummary, gcs::data::kTelemetryChannelCount>
+        channels{};
+  };
+
+  /**
+   * @struct PyramidBucket
+   * @brief One display bucket returned by LogPyramid::Query().
+   */
+  struct PyramidBucket
+  {
+    std::size_t first_frame;
+    std::size_t frame_count;
+    std::uint64_t first_timestamp_us;
+    std::uint64_t last_timestamp_us;
+    PyramidChannelSummary summary;
+  };
+
+  /**
+   * @class LogPyramidBuilder
+   * @brief Incrementally summarizes a frame stream into pyramid records.
+   *
+   * Leaves cover 2^leaf_shift frames and every level above covers twice as
+   * many. A node is written once it is complete: after each leaf come the
+   * ancestors it completes. Node (level, index) therefore sits at a fixed
+   * position in the file, which lets the file grow by appends while a
+   * recording is in progress and still be read at random.
+   */
+  class LogPyramidBuilder
+  {
+  public:
+    /**
+     * @brief Size of the file header.
+     */
+    static constexpr std::size_t kHeaderSize = 32;
+
+    /**
+     * @brief Size of one node record.
+     */
+    static constexpr std::size_t kRecordSize =
+        16 + gcs::data::kTelemetryChannelCount * 3 * sizeof(double);
+
+    /**
+     * @param leaf_shift log2 of the frames per leaf.
+     */
+    explicit LogPyramidBuilder(
+        std::uint32_t leaf_shift = gcs::common::kLogPyramidLeafShift);
+
+    /**
+     * @brief Returns the file header.
+     */
+    std::vector<std::uint8_t> WriteHeader() const;
+
+    /**
+     * @brief Summarizes a run of frames.
+     */
+    void Append(std::span<const gcs::data::TelemetryData> frames);
+
+    /**
+     * @brief Returns the records of the nodes completed since the last
+     * ClearOutput().
+     */
+    std::span<const std::uint8_t> GetOutput() const { return output_; }
+
+    /**
+     * @brief Discards the returned records, keeping the buffer capacity.
+     */
+    void ClearOutput() { output_.clear(); }
+
+    /**
+     * @brief Discards all state, e.g. when a new log file is started.
+     */
+    void Reset();
+
+  private:
+    // Open node of one level.
+    struct Accumulator
+    {
+      std::uint64_t first_timestamp_us = 0;
+      std::uint64_t last_timestamp_us = 0;
+      std::size_t size = 0; // Frames for leaves, children otherwise.
+      std::array<double, gcs::data::kTelemetryChannelCount> min{};
+      std::array<double, gcs::data::kTelemetryChannelCount> max{};
+      std::array<double, gcs::data::kTelemetryChannelCount> sum{};
+      std::array<std::uint64_t, gcs::data::kTelemetryChannelCount> count{};
+    };
+
+    void CompleteLeaf();
+    void Merge(Accumulator &into, const Accumulator &node) const;
+    void Emit(const Accumulator &node);
+
+    std::uint32_t leaf_shift_;
+    std::vector<Accumulator> levels_;
+    std::vector<std::uint8_t> output_;
+  };
+
+  /**
+   * @class LogPyramid
+   * @brief Random-access reader of a log pyramid sidecar.
+   *
+   * Answers any frame range at any zoom from about as many node reads as
+   * buckets requested. Only complete leaves are stored; frames after the
+   * last leaf (see GetFrameCount()) must be read from the log itself.
+   *
+   * The reader is not synchronized.
+   */
+  class LogPyramid
+  {
+  public:
+    /**
+     * @brief Opens a sidecar.
+     * @return false if the file is missing or not a valid pyramid.
+     */
+    bool Open(const std::string &path);
+
+    /**
+     * @brief Closes the sidecar.
+     */
+    void Close();
+
+    bool IsOpen() const { return file_.is_open(); }
+
+    /**
+     * @brief Picks up nodes appended since Open(), e.g. while recording.
+     */
+    void Refresh();
+
+    /**
+     * @brief Frames summarized by one leaf.
+     */
+    std::size_t GetLeafFrames() const { return std::size_t{1} << leaf_shift_; }
+
+    /**
+     * @brief Number of complete leaves.
+     */
+    std::size_t GetLeafCount() const { return leaf_count_; }
+
+    /**
+     * @brief Number of log frames covered by the pyramid.
+     */
+    std::size_t GetFrameCount() const { return leaf_count_ << leaf_shift_; }
+
+    /**
+     * @brief Reads one node.
+     * @param level 0 for leaves.
+     * @param index Node index within the level.
+     * @return false if the node is not complete yet or the read failed.
+     */
+    bool ReadNode(std::size_t level, std::size_t index, PyramidNode &node);
+
+    /**
+     * @brief Finds the first leaf that ends at or after a timestamp.
+     * Timestamps must be non-decreasing.
+     * @return Index of the leaf's first frame, or GetFrameCount() if none.
+     */
+    std::size_t FindFrame(std::uint64_t timestamp_us);
+
+    /**
+     * @brief Summarizes a frame range into display buckets.
+     * @param channel Channel to summarize.
+     * @param first_frame First frame of the range.
+     * @param last_frame One past the last frame of the range.
+     * @param max_buckets Bucket budget. Up to 2 * log2(range) more buckets
+     * may be returned near the end of a growing pyramid.
+     * @param out Replaced by the buckets, in frame order. Buckets are whole
+     * nodes, so the first and last may extend past the range by less than
+     * one bucket. Frames beyond GetFrameCount() are not covered.
+     */
+    void Query(gcs::data::TelemetryChannel channel, std::size_t first_frame,
+               std::size_t last_frame, std::size_t max_buckets,
+               std::vector<PyramidBucket> &out);
+
+  private:
+    std::ifstream file_;
+    std::uint32_t leaf_shift_ = 0;
+    std::size_t leaf_count_ = 0;
+    std::vector<std::uint8_t> record_;
+  };
+
+  /**
+   * @brief Returns the sidecar path of a parsed log, e.g. "a_parsed.pyr"
+   * for "a_parsed.dat".
+   */
+  std::string GetLogPyramidPath(const std::string &log_path);
+
+  /**
+   * @brief Builds or rebuilds the sidecar of a parsed log.
+   * @return false if the log cannot be read or the sidecar not written.
+   */
+  bool BuildLogPyramid(const std::string &log_path);
+
+  /**
+   * @brief Builds the sidecar of a parsed log on an executor, unless an
+   * existing sidecar already covers the whole log.
+   * @param log_path Parsed log (.dat).
+   * @param executor Executor running the build.
+   * @param on_done Optional; called on the executor with the result.
+   */
+  void BuildLogPyramidAsync(std::string log_path,
+                            gcs::common::IExecutor &executor,
+                            gcs::common::Delegate<void(bool)> on_done = {});
+
+} // namespace gcs::logging
+
+#endif // GCS_CORE_LOGGING_LOG_PYRAMID_H_
@@ -0,0 +1,255 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_LOGGING_PARSED_LOG_FORMAT_H_
+#define GCS_CORE_LOGGING_PARSED_LOG_FORMAT_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "data/telemetry.h"
+#include "data/telemetry_channel.h"
+#include "data/timestamp_unwrapper.h"
+
+namespace gcs::logging
+{
+
+  /**
+   * @brief Magic bytes at the start of a versioned parsed log (.dat).
+   * Files without them are legacy dumps of TelemetryData structs.
+   */
+  inline constexpr std::array<std::uint8_t, 8> kParsedLogMagic = {
+      'G', 'C', 'S', 'P', 'A', 'R', 'S', 'D'};
+
+  /**
+   * @brief Newest parsed log format version this build reads and writes.
+   * Version 2 stores 64-bit microsecond timestamps; version 1 files with
+   * 32-bit millisecond timestamps are still read.
+   */
+  inline constexpr std::uint16_t kParsedLogVersion = 2;
+
+  /**
+   * @struct LegacyTelemetryData
+   * @brief In-memory layout of TelemetryData before the microsecond time
+   * base, as dumped by legacy parsed logs without a header.
+   */
+  struct LegacyTelemetryData
+  {
+    std::uint32_t timestamp = 0; ///< System uptime (ms).
+    gcs::data::Vec3 pos;
+    gcs::data::Vec3 vel;
+    gcs::data::Vec3 acc;
+    gcs::data::Quat quat;
+    gcs::data::Vec3 euler;
+    std::uint32_t rx_count = 0;
+    std::uint32_t tx_count = 0;
+    std::uint8_t fsm = 0;
+    std::uint8_t sensor = 0;
+    std::uint8_t ejection = 0;
+  };
+
+  /**
+   * @brief Decodes consecutive LegacyTelemetryData records of a legacy log.
+   * @param unwrapper Extends the 32-bit millisecond timestamps across wraps.
+   * Keep one per file and reset it when reading continues elsewhere.
+   * @return Number of frames decoded; trailing partial records are ignored.
+   */
+  std::size_t DecodeLegacyRecords(std::span<const std::uint8_t> bytes,
+                                  std::span<gcs::data::TelemetryData> frames,
+                                  gcs::data::TimestampUnwrapper &unwrapper);
+
+  /**
+   * @enum ParsedLogEncoding
+   * @brief Storage of the floating-point channels (pos, vel, acc, quat,
+   * euler).
+   */
+  enum class ParsedLogEncoding : std::uint8_t
+  {
+    kFloat64,   ///< Lossless 8-byte doubles.
+    kFloat32,   ///< 4-byte floats.
+    kFixedPoint ///< 4-byte integers with a per-field scale.
+  };
+
+  /**
+   * @enum ParsedFieldId
+   * @brief Identifies a TelemetryData field in the header's field table.
+   * Floating-point channels use kFirstChannel + TelemetryChannel.
+   */
+  enum class ParsedFieldId : std::uint16_t
+  {
+    kTimestampMs = 0, ///< Version 1 timestamp, read as timestamp_us / 1000.
+    kFirstChannel = 1,
+    kRxCount = kFirstChannel + gcs::data::kTelemetryChannelCount,
+    kTxCount,
+    kFsm,
+    kSensor,
+    kEjection,
+    kTimestampUs,
+    kCount
+  };
+
+  /**
+   * @enum ParsedFieldType
+   * @brief On-disk representation of one field. All values are
+   * little-endian.
+   */
+  enum class ParsedFieldType : std::uint8_t
+  {
+    kU8,
+    kU32,
+    kF32,
+    kF64,
+    kFixed32, ///< Signed 32-bit integer; value = raw * scale.
+    kU64
+  };
+
+  /**
+   * @struct ParsedLogField
+   * @brief One entry of the header's field table.
+   */
+  struct ParsedLogField
+  {
+    ParsedFieldId id;
+    ParsedFieldType type;
+    std::uint32_t offset; ///< Byte offset within a record.
+    double scale = 1.0;   ///< Only used by ParsedFieldType::kFixed32.
+  };
+
+  /**
+   * @class ParsedLogSchema
+   * @brief Layout of the records of a versioned parsed log.
+   *
+   * A file consists of a header followed by fixed-size records:
+   *
+   *   magic[8] | version u16 | header_size u16 | record_size u16 |
+   *   field_count u16 | encoding u8 | reserved[7] |
+   *   field_count * (id u16 | type u8 | reserved u8 | offset u32 | scale f64)
+   *
+   * Records are packed without padding in field table order. Readers locate
+   * fields through the table, so fields they do not know are skipped and
+   * fields missing from the file keep their default value.
+   */
+  class ParsedLogSchema
+  {
+  public:
+    /**
+     * @brief Size of the fixed part of the header.
+     */
+    static constexpr std::size_t kFixedHeaderSize = 32;
+
+    /**
+     * @brief Size of one field table entry.
+     */
+    static constexpr std::size_t kFieldEntrySize = 16;
+
+    /**
+     * @brief Creates the standard layout of the current version.
+     * @param encoding Storage of the floating-point channels.
+     */
+    explicit ParsedLogSchema(ParsedLogEncoding encoding);
+
+    /**
+     * @brief Checks whether a file starts with kParsedLogMagic.
+     */
+    static bool HasMagic(std::span<const std::uint8_t> bytes);
+
+    /**
+     * @brief Parses a header.
+     * @param bytes Start of the file; must contain at least the whole header.
+     * @return The schema, or nullopt if the header is malformed, incomplete
+     * or of a newer version.
+     */
+    static std::optional<ParsedLogSchema> ReadHeader(
+        std::span<const std::uint8_t> bytes);
+
+    /**
+     * @brief Reads the header of a parsed log file.
+     * @param file Stream positioned at the start of the file.
+     * @param schema Receives the layout; left empty for legacy struct dumps.
+     * @return false if the header is malformed. On success the stream is
+     * positioned at the first record.
+     */
+    static bool ReadFileHeader(std::istream &file,
+                               std::optional<ParsedLogSchema> &schema);
+
+    /**
+     * @brief Returns the encoded header, to be written at the start of the
+     * file.
+     */
+    std::vector<std::uint8_t> WriteHeader() const;
+
+    /**
+     * @brief Encodes one frame.
+     * @param frame Frame to encode.
+     * @param record Destination of at least GetRecordSize() bytes.
+     */
+    void Encode(const gcs::data::TelemetryData &frame,
+                std::span<std::uint8_t> record) const;
+
+    /**
+     * @brief Decodes one record, reading the fields in place.
+     * @param record Record of at least GetRecordSize() bytes.
+     * @param frame Destination frame. Version 1 millisecond timestamps are
+     * converted as is, without unwrapping.
+     */
+    void Decode(std::span<const std::uint8_t> record,
+                gcs::data::TelemetryData &frame) const;
+
+    /**
+     * @brief Decodes consecutive records straight from a byte buffer.
+     * @param unwrapper Extends version 1 millisecond timestamps across their
+     * 32-bit wrap; unused for microsecond timestamps. Keep one per file and
+     * reset it when reading continues elsewhere.
+     * @return Number of frames decoded; trailing partial records are ignored.
+     */
+    std::size_t DecodeRecords(std::span<const std::uint8_t> bytes,
+                              std::span<gcs::data::TelemetryData> frames,
+                              gcs::data::TimestampUnwrapper &unwrapper) const;
+
+    /**
+     * @brief Reads the timestamp (us) of a record without decoding the rest.
+     * Version 1 millisecond timestamps are not unwrapped.
+     */
+    std::uint64_t ReadTimestamp(std::span<const std::uint8_t> record) const;
+
+    /**
+     * @brief Reads one floating-point channel of a record without decoding
+     * the rest. Channels missing from the file read as 0.
+     */
+    double ReadChannel(std::span<const std::uint8_t> record,
+                       gcs::data::TelemetryChannel channel) const;
+
+    std::uint16_t GetVersion() const { return version_; }
+    ParsedLogEncoding GetEncoding() const { return encoding_; }
+    std::size_t GetHeaderSize() const
+    {
+      return kFixedHeaderSize + fields_.size() * kFieldEntrySize;
+    }
+    std::size_t GetRecordSize() const { return record_size_; }
+    std::span<const ParsedLogField> GetFields() const { return fields_; }
+
+  private:
+    // Empty schema, filled in by ReadHeader().
+    ParsedLogSchema() = default;
+
+    void IndexFields();
+    const ParsedLogField *FindField(ParsedFieldId id) const;
+
+    std::uint16_t version_ = kParsedLogVersion;
+    ParsedLogEncoding encoding_ = ParsedLogEncoding::kFloat64;
+    std::size_t record_size_ = 0;
+    std::vector<ParsedLogField> fields_;
+
+    // Index into fields_ per known field id, or -1 if absent.
+    std::array<int, static_cast<std::size_t>(ParsedFieldId::kCount)> index_{};
+  };
+
+} // namespace gcs::logging
+
+#endif // GCS_CORE_LOGGING_PARSED_LOG_FORMAT_H_
@@ -0,0 +1,38 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_TRANSPORT_WINRT_BYTES_H_
+#define GCS_CORE_TRANSPORT_WINRT_BYTES_H_
+
+#include <cstdint>
+#include <span>
+
+#include <winrt/Windows.Foundation.h>
+
+namespace gcs::transport
+{
+
+  /**
+   * @brief Views a WinRT byte array as a std::span, e.g. to feed a buffer
+   * read from a WinRT stream to IParser::PushData(). No bytes are copied.
+   */
+  inline std::span<const std::uint8_t> AsSpan(
+      winrt::array_view<std::uint8_t const> data)
+  {
+    return {data.data(), data.size()};
+  }
+
+  /**
+   * @brief Views a byte span as a WinRT array view, e.g. to pass a portable
+   * buffer to SerialManager::WriteAsync(). No bytes are copied.
+   */
+  inline winrt::array_view<std::uint8_t const> AsArrayView(
+      std::span<const std::uint8_t> data)
+  {
+    return {data.data(), data.data() + data.size()};
+  }
+
+} // namespace gcs::transport
+
+#endif // GCS_CORE_TRANSPORT_WINRT_BYTES_H_
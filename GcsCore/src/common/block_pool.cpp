@@ -0,0 +1,96 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "common/block_pool.h"
+
+#include <algorithm>
+#include <new>
+
+namespace gcs::common
+{
+
+  namespace
+  {
+    bool IsExtended(std::size_t alignment)
+    {
+      return alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+    }
+  } // namespace
+
+  BlockPool::BlockPool(std::size_t max_free_blocks)
+      : max_free_blocks_(max_free_blocks)
+  {
+  }
+
+  BlockPool::~BlockPool()
+  {
+    while (free_list_ != nullptr)
+    {
+      FreeBlock *block = free_list_;
+      free_list_ = block->next;
+      ::operator delete(block);
+    }
+  }
+
+  void *BlockPool::Allocate(std::size_t size, std::size_t alignment)
+  {
+    if (IsExtended(alignment))
+      return ::operator new(size, std::align_val_t(alignment));
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (block_size_ == 0)
+        block_size_ = std::max(size, sizeof(FreeBlock));
+
+      if (size <= block_size_)
+      {
+        if (free_list_ != nullptr)
+        {
+          FreeBlock *block = free_list_;
+          free_list_ = block->next;
+          --free_count_;
+          return block;
+        }
+        ++heap_allocations_;
+        size = block_size_;
+      }
+    }
+    return ::operator new(size);
+  }
+
+  void BlockPool::Deallocate(void *block, std::size_t size,
+                             std::size_t alignment) noexcept
+  {
+    if (IsExtended(alignment))
+    {
+      ::operator delete(block, std::align_val_t(alignment));
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (size <= block_size_ && free_count_ < max_free_blocks_)
+      {
+        auto *free_block = ::new (block) FreeBlock{free_list_};
+        free_list_ = free_block;
+        ++free_count_;
+        return;
+      }
+    }
+    ::operator delete(block);
+  }
+
+  std::size_t BlockPool::GetFreeCount() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return free_count_;
+  }
+
+  std::uint64_t BlockPool::GetHeapAllocationCount() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return heap_allocations_;
+  }
+
+} // namespace gcs::common
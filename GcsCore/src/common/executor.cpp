@@ -0,0 +1,193 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "common/executor.h"
+
+#include <utility>
+
+namespace gcs::common
+{
+
+  namespace
+  {
+    // Pool and queue index of the worker running on this thread, if any.
+    thread_local const ThreadPoolExecutor *tls_pool = nullptr;
+    thread_local std::size_t tls_worker_index = 0;
+  } // namespace
+
+  ThreadPoolExecutor::ThreadPoolExecutor(std::size_t thread_count)
+  {
+    if (thread_count == 0)
+      thread_count = 1;
+
+    queues_.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; ++i)
+    {
+      queues_.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    workers_.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; ++i)
+    {
+      workers_.emplace_back(&ThreadPoolExecutor::WorkerLoop, this, i);
+    }
+  }
+
+  ThreadPoolExecutor::~ThreadPoolExecutor()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    cv_.notify_all();
+
+    for (auto &worker : workers_)
+    {
+      worker.join();
+    }
+
+    // Discarded tasks are destroyed here, after every worker has stopped.
+    injected_.clear();
+    queues_.clear();
+  }
+
+  void ThreadPoolExecutor::Post(Task task)
+  {
+    std::size_t index = CurrentWorkerIndex();
+    {
+      // Holding mutex_ also orders the increment with a worker that is about
+      // to go to sleep.
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopping_)
+        return;
+      pending_.fetch_add(1, std::memory_order_release);
+
+      // A single worker has no peers to share with; keep it strictly FIFO.
+      if (index < queues_.size() && queues_.size() > 1)
+      {
+        std::lock_guard<std::mutex> queue_lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(std::move(task));
+      }
+      else
+      {
+        injected_.push_back(std::move(task));
+      }
+    }
+    cv_.notify_one();
+  }
+
+  bool ThreadPoolExecutor::RunsTasksOnlyOnCurrentThread() const
+  {
+    return workers_.size() == 1 && tls_pool == this;
+  }
+
+  bool ThreadPoolExecutor::RunsTasksOnCurrentThread() const
+  {
+    return tls_pool == this;
+  }
+
+  void ThreadPoolExecutor::WorkerLoop(std::size_t index)
+  {
+    tls_pool = this;
+    tls_worker_index = index;
+
+    while (true)
+    {
+      Task task;
+      if (TryPop(index, task))
+      {
+        task();
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this]()
+               { return stopping_ || pending_.load(std::memory_order_acquire) > 0; });
+      if (stopping_)
+        return;
+    }
+  }
+
+  bool ThreadPoolExecutor::TryPop(std::size_t index, Task &task)
+  {
+    if (pending_.load(std::memory_order_acquire) == 0)
+      return false;
+
+    // Own deque first, newest task first.
+    if (index < queues_.size())
+    {
+      WorkerQueue &own = *queues_[index];
+      std::lock_guard<std::mutex> lock(own.mutex);
+      if (!own.tasks.empty())
+      {
+        task = std::move(own.tasks.back());
+        own.tasks.pop_back();
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!injected_.empty())
+      {
+        task = std::move(injected_.front());
+        injected_.pop_front();
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+
+    // Steal the oldest task of a peer.
+    std::size_t start = index < queues_.size() ? index + 1 : 0;
+    for (std::size_t i = 0; i < queues_.size(); ++i)
+    {
+      WorkerQueue &victim = *queues_[(start + i) % queues_.size()];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if (!victim.tasks.empty())
+      {
+        task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  std::size_t ThreadPoolExecutor::CurrentWorkerIndex() const
+  {
+    return tls_pool == this ? tls_worker_index : queues_.size();
+  }
+
+  void ManualExecutor::Post(Task task)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+
+  bool ManualExecutor::RunsTasksOnlyOnCurrentThread() const
+  {
+    return pump_thread_.load(std::memory_order_relaxed) ==
+           std::this_thread::get_id();
+  }
+
+  std::size_t ManualExecutor::RunPending()
+  {
+    pump_thread_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
+    std::deque<Task> pending;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      pending.swap(tasks_);
+    }
+
+    for (auto &task : pending)
+    {
+      task();
+    }
+    return pending.size();
+  }
+
+} // namespace gcs::common
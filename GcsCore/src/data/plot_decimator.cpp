@@ -0,0 +1,355 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "data/plot_decimator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace gcs::data
+{
+
+  namespace
+  {
+    constexpr std::size_t kLeafFrames = PlotDecimator::kLeafFrames;
+    static_assert((kLeafFrames & (kLeafFrames - 1)) == 0 &&
+                      TelemetryColumnStore::kChunkFrames % kLeafFrames == 0,
+                  "Leaves must be a power of two and not straddle chunks");
+
+    constexpr auto kNoFrame = std::numeric_limits<std::uint32_t>::max();
+
+    // LTTB runs over raw frames up to this many frames per output point and
+    // over min/max candidates beyond.
+    constexpr std::size_t kLttbRawFactor = 4;
+
+    // Picks max_points of points by Largest-Triangle-Three-Buckets. The first
+    // and last points are always kept.
+    void SelectLttb(const std::vector<PlotPoint> &points,
+                    std::size_t max_points, std::vector<PlotPoint> &out)
+    {
+      const std::size_t count = points.size();
+      const double every =
+          static_cast<double>(count - 2) / static_cast<double>(max_points - 2);
+      // Times relative to the first point keep full precision as doubles.
+      const std::uint64_t origin = points.front().timestamp_us;
+      auto time = [&points, origin](std::size_t i)
+      { return static_cast<double>(points[i].timestamp_us - origin); };
+
+      out.push_back(points.front());
+      std::size_t selected = 0;
+      for (std::size_t bucket = 0; bucket < max_points - 2; ++bucket)
+      {
+        // Average of the next bucket, the third corner of the triangle.
+        auto next_begin = static_cast<std::size_t>((bucket + 1) * every) + 1;
+        auto next_end = std::min(
+            static_cast<std::size_t>((bucket + 2) * every) + 1, count);
+        double avg_x = 0.0;
+        double avg_y = 0.0;
+        for (std::size_t i = next_begin; i < next_end; ++i)
+        {
+          avg_x += time(i);
+          avg_y += points[i].value;
+        }
+        avg_x /= static_cast<double>(next_end - next_begin);
+        avg_y /= static_cast<double>(next_end - next_begin);
+
+        const double ax = time(selected);
+        const double ay = points[selected].value;
+        auto begin = static_cast<std::size_t>(bucket * every) + 1;
+        auto end = static_cast<std::size_t>((bucket + 1) * every) + 1;
+        double max_area = -1.0;
+        std::size_t best = begin;
+        for (std::size_t i = begin; i < end; ++i)
+        {
+          double area = std::abs((ax - avg_x) * (points[i].value - ay) -
+                                 (ax - time(i)) * (avg_y - ay));
+          if (area > max_area)
+          {
+            max_area = area;
+            best = i;
+          }
+        }
+        out.push_back(points[best]);
+        selected = best;
+      }
+      out.push_back(points.back());
+    }
+  } // namespace
+
+  PlotDecimator::PlotDecimator(const TelemetryColumnStore &store)
+      : store_(&store)
+  {
+  }
+
+  void PlotDecimator::Update()
+  {
+    std::size_t available = store_->GetFrameCount();
+    if (available < summarized_)
+      Reset();
+
+    while (available - summarized_ >= kLeafFrames)
+    {
+      for (std::size_t c = 0; c < kTelemetryChannelCount; ++c)
+      {
+        auto channel = static_cast<TelemetryChannel>(c);
+        Node leaf = ScanFrames(channel, summarized_, summarized_ + kLeafFrames);
+        Tree &tree = trees_[c];
+        if (tree.empty())
+          tree.emplace_back();
+        tree[0].push_back(leaf);
+
+        // Fold the leaf into its ancestors. A level is added once the one
+        // below holds two nodes.
+        std::size_t index = tree[0].size() - 1;
+        for (std::size_t level = 1;
+             level < tree.size() || tree[level - 1].size() > 1; ++level)
+        {
+          if (level == tree.size())
+          {
+            Node root = tree[level - 1][0];
+            Merge(root, tree[level - 1][1]);
+            tree.push_back({root});
+            continue;
+          }
+          std::size_t parent = index >> level;
+          if (parent < tree[level].size())
+            Merge(tree[level][parent], leaf);
+          else
+            tree[level].push_back(leaf);
+        }
+      }
+      summarized_ += kLeafFrames;
+    }
+  }
+
+  void PlotDecimator::Reset()
+  {
+    for (Tree &tree : trees_)
+    {
+      tree.clear();
+    }
+    summarized_ = 0;
+  }
+
+  void PlotDecimator::Decimate(TelemetryChannel channel, std::uint64_t begin,
+                               std::uint64_t end, std::size_t max_points,
+                               DecimationMode mode,
+                               std::vector<PlotPoint> &out) const
+  {
+    auto timestamps = store_->GetTimestamps();
+    auto partition = [&](auto before)
+    {
+      std::size_t lo = 0;
+      std::size_t hi = timestamps.GetFrameCount();
+      while (lo < hi)
+      {
+        std::size_t mid = lo + (hi - lo) / 2;
+        if (before(timestamps[mid]))
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+      return lo;
+    };
+
+    std::size_t first = partition([begin](std::uint64_t t)
+                                  { return t < begin; });
+    std::size_t last = partition([end](std::uint64_t t)
+                                 { return t <= end; });
+    DecimateFrames(channel, first, last, max_points, mode, out);
+  }
+
+  void PlotDecimator::DecimateFrames(TelemetryChannel channel,
+                                     std::size_t first, std::size_t last,
+                                     std::size_t max_points,
+                                     DecimationMode mode,
+                                     std::vector<PlotPoint> &out) const
+  {
+    out.clear();
+    last = std::min(last, store_->GetFrameCount());
+    if (first >= last)
+      return;
+
+    max_points = std::max<std::size_t>(max_points, 4);
+    if (last - first <= max_points)
+    {
+      auto values = store_->GetChannel(channel);
+      for (std::size_t frame = first; frame < last; ++frame)
+      {
+        if (!std::isnan(values[frame]))
+          out.push_back(MakePoint(channel, frame));
+      }
+      return;
+    }
+
+    switch (mode)
+    {
+    case DecimationMode::kMinMax:
+      AppendMinMax(channel, first, last, max_points / 2, out);
+      break;
+    case DecimationMode::kLttb:
+      AppendLttb(channel, first, last, max_points, out);
+      break;
+    }
+  }
+
+  PlotDecimator::Node PlotDecimator::EmptyNode()
+  {
+    return {0.0, 0.0, kNoFrame, kNoFrame};
+  }
+
+  void PlotDecimator::Merge(Node &into, const Node &node)
+  {
+    if (node.min_frame == kNoFrame)
+      return;
+    if (into.min_frame == kNoFrame)
+    {
+      into = node;
+      return;
+    }
+    // Ties go to the earlier frame, whatever the merge order.
+    if (node.min < into.min ||
+        (node.min == into.min && node.min_frame < into.min_frame))
+    {
+      into.min = node.min;
+      into.min_frame = node.min_frame;
+    }
+    if (node.max > into.max ||
+        (node.max == into.max && node.max_frame < into.max_frame))
+    {
+      into.max = node.max;
+      into.max_frame = node.max_frame;
+    }
+  }
+
+  PlotDecimator::Node PlotDecimator::ScanFrames(TelemetryChannel channel,
+                                                std::size_t first,
+                                                std::size_t last) const
+  {
+    Node node = EmptyNode();
+    auto column = store_->GetChannel(channel);
+    while (first < last)
+    {
+      std::size_t chunk = first / TelemetryColumnStore::kChunkFrames;
+      std::size_t row = first % TelemetryColumnStore::kChunkFrames;
+      std::span<const double> values = column.GetChunk(chunk);
+      std::size_t end = std::min(values.size(), row + (last - first));
+      std::size_t base = first - row;
+
+      for (std::size_t i = row; i < end; ++i)
+      {
+        double value = values[i];
+        if (std::isnan(value))
+          continue;
+        auto frame = static_cast<std::uint32_t>(base + i);
+        if (node.min_frame == kNoFrame)
+        {
+          node = {value, value, frame, frame};
+          continue;
+        }
+        if (value < node.min)
+        {
+          node.min = value;
+          node.min_frame = frame;
+        }
+        if (value > node.max)
+        {
+          node.max = value;
+          node.max_frame = frame;
+        }
+      }
+      first = base + end;
+    }
+    return node;
+  }
+
+  PlotDecimator::Node PlotDecimator::QueryRange(TelemetryChannel channel,
+                                                std::size_t first,
+                                                std::size_t last) const
+  {
+    std::size_t leaf_begin = (first + kLeafFrames - 1) / kLeafFrames;
+    std::size_t leaf_end = std::min(last, summarized_) / kLeafFrames;
+    if (leaf_begin >= leaf_end)
+      return ScanFrames(channel, first, last);
+
+    // Raw frames up to the first whole leaf, the largest aligned nodes in
+    // between, then raw frames after the last whole leaf.
+    Node node = ScanFrames(channel, first, leaf_begin * kLeafFrames);
+    const Tree &tree = trees_[static_cast<std::size_t>(channel)];
+    std::size_t lo = leaf_begin;
+    std::size_t hi = leaf_end;
+    for (std::size_t level = 0; lo < hi; ++level, lo >>= 1, hi >>= 1)
+    {
+      if (lo & 1)
+        Merge(node, tree[level][lo++]);
+      if (hi & 1)
+        Merge(node, tree[level][--hi]);
+    }
+    Merge(node, ScanFrames(channel, leaf_end * kLeafFrames, last));
+    return node;
+  }
+
+  PlotPoint PlotDecimator::MakePoint(TelemetryChannel channel,
+                                     std::size_t frame) const
+  {
+    return {store_->GetTimestamps()[frame], store_->GetChannel(channel)[frame]};
+  }
+
+  void PlotDecimator::AppendMinMax(TelemetryChannel channel, std::size_t first,
+                                   std::size_t last, std::size_t buckets,
+                                   std::vector<PlotPoint> &out) const
+  {
+    std::size_t count = last - first;
+    for (std::size_t bucket = 0; bucket < buckets; ++bucket)
+    {
+      Node node = QueryRange(channel, first + count * bucket / buckets,
+                             first + count * (bucket + 1) / buckets);
+      if (node.min_frame == kNoFrame)
+        continue;
+
+      std::size_t a = node.min_frame;
+      std::size_t b = node.max_frame;
+      if (a > b)
+        std::swap(a, b);
+      out.push_back(MakePoint(channel, a));
+      if (b != a)
+        out.push_back(MakePoint(channel, b));
+    }
+  }
+
+  void PlotDecimator::AppendLttb(TelemetryChannel channel, std::size_t first,
+                                 std::size_t last, std::size_t max_points,
+                                 std::vector<PlotPoint> &out) const
+  {
+    std::vector<PlotPoint> candidates;
+    if (last - first <= kLttbRawFactor * max_points)
+    {
+      auto values = store_->GetChannel(channel);
+      candidates.reserve(last - first);
+      for (std::size_t frame = first; frame < last; ++frame)
+      {
+        if (!std::isnan(values[frame]))
+          candidates.push_back(MakePoint(channel, frame));
+      }
+    }
+    else
+    {
+      // The extremes of 2 * max_points buckets keep every peak LTTB could
+      // pick while bounding the work by the budget.
+      candidates.reserve(4 * max_points);
+      AppendMinMax(channel, first, last, 2 * max_points, candidates);
+    }
+
+    if (candidates.size() <= max_points)
+    {
+      out = std::move(candidates);
+      return;
+    }
+    out.reserve(max_points);
+    SelectLttb(candidates, max_points, out);
+  }
+
+} // namespace gcs::data
@@ -0,0 +1,616 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "data/telemetry_codec.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace gcs::data
+{
+
+  namespace
+  {
+    using CodecState = detail::TelemetryCodecState;
+
+    // Marks a channel without a previous XOR window; no leading zero count
+    // can reach it, so the first non-zero XOR always sends a new window.
+    constexpr std::uint8_t kNoWindow = 0xFF;
+
+    // Leading zeros are sent in 5 bits.
+    constexpr unsigned kMaxLeadingZeros = 31;
+
+    // Smallest encodings of a frame, used to reject impossible frame counts:
+    // the verbatim first frame, and a frame where nothing changed.
+    constexpr std::size_t kFirstFrameBits =
+        64 + 2 * 32 + kTelemetryChannelCount * 64 + CodecState::kFlagCount * 8;
+    constexpr std::size_t kMinFrameBits =
+        CodecState::kCounterCount + kTelemetryChannelCount + 1;
+
+    void StoreU32(std::uint8_t *out, std::uint32_t value)
+    {
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+        out[i] = static_cast<std::uint8_t>(value >> (8 * i));
+      }
+    }
+
+    std::uint32_t LoadU32(const std::uint8_t *in)
+    {
+      return static_cast<std::uint32_t>(in[0]) |
+             static_cast<std::uint32_t>(in[1]) << 8 |
+             static_cast<std::uint32_t>(in[2]) << 16 |
+             static_cast<std::uint32_t>(in[3]) << 24;
+    }
+
+    void StoreU64(std::uint8_t *out, std::uint64_t value)
+    {
+      StoreU32(out, static_cast<std::uint32_t>(value));
+      StoreU32(out + 4, static_cast<std::uint32_t>(value >> 32));
+    }
+
+    std::uint64_t LoadU64(const std::uint8_t *in)
+    {
+      return LoadU32(in) | std::uint64_t{LoadU32(in + 4)} << 32;
+    }
+
+    // The escape bucket of a counter's delta-of-delta: 33 bits cover any
+    // difference of two 32-bit deltas; 64-bit counters wrap it instead.
+    unsigned EscapeBits(std::size_t index)
+    {
+      return std::min(CodecState::kCounterBits[index] + 1, 64u);
+    }
+
+    std::array<std::uint64_t, CodecState::kCounterCount> GetCounters(
+        const TelemetryData &frame)
+    {
+      return {frame.timestamp_us, frame.rx_count, frame.tx_count};
+    }
+
+    std::array<std::uint8_t, CodecState::kFlagCount> GetFlags(
+        const TelemetryData &frame)
+    {
+      return {frame.fsm, frame.sensor, frame.ejection};
+    }
+
+    // Copies the channels in TelemetryChannel order without the per-channel
+    // branches of GetChannelValue().
+    std::array<double, kTelemetryChannelCount> GetChannels(
+        const TelemetryData &frame)
+    {
+      std::array<double, kTelemetryChannelCount> channels;
+      auto out = std::copy(frame.pos.data.begin(), frame.pos.data.end(),
+                           channels.begin());
+      out = std::copy(frame.vel.data.begin(), frame.vel.data.end(), out);
+      out = std::copy(frame.acc.data.begin(), frame.acc.data.end(), out);
+      out = std::copy(frame.quat.data.begin(), frame.quat.data.end(), out);
+      std::copy(frame.euler.data.begin(), frame.euler.data.end(), out);
+      return channels;
+    }
+
+    void SetChannels(TelemetryData &frame,
+                     const std::array<double, kTelemetryChannelCount> &values)
+    {
+      auto in = values.begin();
+      std::copy(in, in + 3, frame.pos.data.begin());
+      std::copy(in + 3, in + 6, frame.vel.data.begin());
+      std::copy(in + 6, in + 9, frame.acc.data.begin());
+      std::copy(in + 9, in + 13, frame.quat.data.begin());
+      std::copy(in + 13, in + 16, frame.euler.data.begin());
+    }
+  } // namespace
+
+  // --- TelemetryEncoder ---
+
+  TelemetryEncoder::TelemetryEncoder(std::size_t block_frames)
+      : block_frames_(std::max<std::size_t>(block_frames, 1))
+  {
+  }
+
+  void TelemetryEncoder::Encode(const TelemetryData &frame)
+  {
+    if (frame_count_ == 0)
+      BeginBlock(frame);
+    else
+      EncodeDelta(frame);
+
+    ++frame_count_;
+    last_timestamp_us_ = frame.timestamp_us;
+    if (frame_count_ >= block_frames_)
+      Flush();
+  }
+
+  void TelemetryEncoder::Encode(std::span<const TelemetryData> frames)
+  {
+    for (const TelemetryData &frame : frames)
+    {
+      Encode(frame);
+    }
+  }
+
+  void TelemetryEncoder::Flush()
+  {
+    if (frame_count_ == 0)
+      return;
+
+    // Pad the last partial byte with zeros.
+    while (bit_count_ >= 8)
+    {
+      bit_count_ -= 8;
+      output_.push_back(static_cast<std::uint8_t>(bit_buffer_ >> bit_count_));
+    }
+    if (bit_count_ > 0)
+    {
+      output_.push_back(
+          static_cast<std::uint8_t>(bit_buffer_ << (8 - bit_count_)));
+    }
+    bit_buffer_ = 0;
+    bit_count_ = 0;
+
+    // Header: version u8 | reserved[3] | payload_size u32 |
+    // frame_count u32 | first_timestamp_us u64 | last_timestamp_us u64
+    std::uint8_t *header = output_.data() + block_start_;
+    std::size_t payload_size = output_.size() - block_start_ - kBlockHeaderSize;
+    header[0] = kTelemetryCodecVersion;
+    header[1] = header[2] = header[3] = 0;
+    StoreU32(header + 4, static_cast<std::uint32_t>(payload_size));
+    StoreU32(header + 8, frame_count_);
+    StoreU64(header + 12, first_timestamp_us_);
+    StoreU64(header + 20, last_timestamp_us_);
+
+    block_start_ = output_.size();
+    frame_count_ = 0;
+  }
+
+  std::vector<std::uint8_t> TelemetryEncoder::TakeOutput()
+  {
+    std::vector<std::uint8_t> completed;
+    if (frame_count_ == 0)
+    {
+      completed.swap(output_);
+    }
+    else
+    {
+      auto split = output_.begin() + static_cast<std::ptrdiff_t>(block_start_);
+      completed.assign(output_.begin(), split);
+      output_.erase(output_.begin(), split);
+    }
+    block_start_ = 0;
+    return completed;
+  }
+
+  void TelemetryEncoder::BeginBlock(const TelemetryData &frame)
+  {
+    output_.resize(block_start_ + kBlockHeaderSize);
+    first_timestamp_us_ = frame.timestamp_us;
+
+    auto counters = GetCounters(frame);
+    for (std::size_t i = 0; i < counters.size(); ++i)
+    {
+      WriteBits(counters[i], CodecState::kCounterBits[i]);
+      state_.counters[i] = counters[i];
+      state_.deltas[i] = 0;
+    }
+
+    auto channels = GetChannels(frame);
+    for (std::size_t i = 0; i < channels.size(); ++i)
+    {
+      std::uint64_t bits = std::bit_cast<std::uint64_t>(channels[i]);
+      WriteBits(bits, 64);
+      state_.channels[i] = bits;
+      state_.leading[i] = kNoWindow;
+      state_.trailing[i] = 0;
+    }
+
+    state_.flags = GetFlags(frame);
+    for (std::uint8_t flag : state_.flags)
+    {
+      WriteBits(flag, 8);
+    }
+  }
+
+  void TelemetryEncoder::EncodeDelta(const TelemetryData &frame)
+  {
+    auto counters = GetCounters(frame);
+    for (std::size_t i = 0; i < counters.size(); ++i)
+    {
+      WriteCounter(i, counters[i]);
+    }
+
+    auto channels = GetChannels(frame);
+    for (std::size_t i = 0; i < channels.size(); ++i)
+    {
+      WriteChannel(i, channels[i]);
+    }
+
+    auto flags = GetFlags(frame);
+    if (flags == state_.flags)
+    {
+      WriteBits(0, 1);
+      return;
+    }
+    WriteBits(1, 1);
+    for (std::size_t i = 0; i < flags.size(); ++i)
+    {
+      if (flags[i] == state_.flags[i])
+        WriteBits(0, 1);
+      else
+        WriteBits(0x100u | flags[i], 9);
+    }
+    state_.flags = flags;
+  }
+
+  void TelemetryEncoder::WriteBits(std::uint64_t value, unsigned count)
+  {
+    if (count > 32)
+    {
+      WriteBits(value >> 32, count - 32);
+      value &= 0xFFFFFFFFu;
+      count = 32;
+    }
+    if (count == 0)
+      return;
+
+    // At most 31 bits are pending, so 32 more always fit.
+    bit_buffer_ = (bit_buffer_ << count) |
+                  (value & ((std::uint64_t{1} << count) - 1));
+    bit_count_ += count;
+    if (bit_count_ >= 32)
+    {
+      bit_count_ -= 32;
+      auto word = static_cast<std::uint32_t>(bit_buffer_ >> bit_count_);
+      std::size_t size = output_.size();
+      output_.resize(size + 4);
+      output_[size] = static_cast<std::uint8_t>(word >> 24);
+      output_[size + 1] = static_cast<std::uint8_t>(word >> 16);
+      output_[size + 2] = static_cast<std::uint8_t>(word >> 8);
+      output_[size + 3] = static_cast<std::uint8_t>(word);
+    }
+  }
+
+  void TelemetryEncoder::WriteCounter(std::size_t index, std::uint64_t value)
+  {
+    // Deltas wrap like the counters, and delta-of-deltas modulo 2^64; the
+    // decoder undoes both with the same wrapping arithmetic.
+    std::uint64_t diff = value - state_.counters[index];
+    std::int64_t delta =
+        CodecState::kCounterBits[index] == 32
+            ? static_cast<std::int32_t>(static_cast<std::uint32_t>(diff))
+            : static_cast<std::int64_t>(diff);
+    auto dod = static_cast<std::int64_t>(
+        static_cast<std::uint64_t>(delta) -
+        static_cast<std::uint64_t>(state_.deltas[index]));
+    state_.counters[index] = value;
+    state_.deltas[index] = delta;
+
+    auto zigzag = (static_cast<std::uint64_t>(dod) << 1) ^
+                  static_cast<std::uint64_t>(dod >> 63);
+    if (zigzag == 0)
+    {
+      WriteBits(0, 1);
+    }
+    else if (zigzag < (1u << 7))
+    {
+      WriteBits((0b10u << 7) | zigzag, 9);
+    }
+    else if (zigzag < (1u << 9))
+    {
+      WriteBits((0b110u << 9) | zigzag, 12);
+    }
+    else if (zigzag < (1u << 12))
+    {
+      WriteBits((0b1110u << 12) | zigzag, 16);
+    }
+    else
+    {
+      WriteBits(0b1111u, 4);
+      WriteBits(zigzag, EscapeBits(index));
+    }
+  }
+
+  void TelemetryEncoder::WriteChannel(std::size_t index, double value)
+  {
+    std::uint64_t bits = std::bit_cast<std::uint64_t>(value);
+    std::uint64_t diff = bits ^ state_.channels[index];
+    state_.channels[index] = bits;
+    if (diff == 0)
+    {
+      WriteBits(0, 1);
+      return;
+    }
+
+    unsigned leading = std::min<unsigned>(std::countl_zero(diff),
+                                          kMaxLeadingZeros);
+    unsigned trailing = std::countr_zero(diff);
+    if (leading >= state_.leading[index] && trailing >= state_.trailing[index])
+    {
+      // Fits the previous window: '10' + window bits.
+      unsigned width = 64 - state_.leading[index] - state_.trailing[index];
+      WriteBits(0b10, 2);
+      WriteBits(diff >> state_.trailing[index], width);
+      return;
+    }
+
+    // New window: '11' + leading zeros (5 bits) + width - 1 (6 bits) + bits.
+    unsigned width = 64 - leading - trailing;
+    WriteBits((0b11u << 11) | (leading << 6) | (width - 1), 13);
+    WriteBits(diff >> trailing, width);
+    state_.leading[index] = static_cast<std::uint8_t>(leading);
+    state_.trailing[index] = static_cast<std::uint8_t>(trailing);
+  }
+
+  // --- TelemetryDecoder ---
+
+  TelemetryDecoder::TelemetryDecoder(std::span<const std::uint8_t> stream)
+      : stream_(stream)
+  {
+  }
+
+  bool TelemetryDecoder::Decode(TelemetryData &frame)
+  {
+    if (remaining_ == 0 && !Seek(next_block_))
+      return false;
+
+    if (first_)
+    {
+      DecodeFirst(frame);
+      first_ = false;
+    }
+    else
+    {
+      DecodeDelta(frame);
+    }
+
+    if (overrun_)
+    {
+      remaining_ = 0;
+      next_block_ = stream_.size();
+      return false;
+    }
+    --remaining_;
+    return true;
+  }
+
+  std::size_t TelemetryDecoder::Decode(std::span<TelemetryData> frames)
+  {
+    std::size_t count = 0;
+    while (count < frames.size() && Decode(frames[count]))
+    {
+      ++count;
+    }
+    return count;
+  }
+
+  bool TelemetryDecoder::Seek(std::size_t offset)
+  {
+    auto info = ReadBlockInfo(stream_, offset);
+    if (!info)
+    {
+      remaining_ = 0;
+      next_block_ = stream_.size();
+      return false;
+    }
+
+    cursor_ = stream_.data() + offset + TelemetryEncoder::kBlockHeaderSize;
+    end_ = stream_.data() + offset + info->size;
+    next_block_ = offset + info->size;
+    remaining_ = info->frame_count;
+    first_ = true;
+    bit_buffer_ = 0;
+    bit_count_ = 0;
+    overrun_ = false;
+    return true;
+  }
+
+  std::optional<TelemetryBlockInfo> TelemetryDecoder::ReadBlockInfo(
+      std::span<const std::uint8_t> stream, std::size_t offset)
+  {
+    constexpr std::size_t kHeaderSize = TelemetryEncoder::kBlockHeaderSize;
+    if (offset > stream.size() || stream.size() - offset < kHeaderSize)
+      return std::nullopt;
+
+    const std::uint8_t *header = stream.data() + offset;
+    std::size_t payload_size = LoadU32(header + 4);
+    TelemetryBlockInfo info;
+    info.offset = offset;
+    info.size = kHeaderSize + payload_size;
+    info.frame_count = LoadU32(header + 8);
+    info.first_timestamp_us = LoadU64(header + 12);
+    info.last_timestamp_us = LoadU64(header + 20);
+
+    if (header[0] != kTelemetryCodecVersion || info.frame_count == 0 ||
+        payload_size > stream.size() - offset - kHeaderSize)
+      return std::nullopt;
+
+    std::size_t payload_bits = payload_size * 8;
+    if (payload_bits < kFirstFrameBits ||
+        info.frame_count - 1 > (payload_bits - kFirstFrameBits) / kMinFrameBits)
+      return std::nullopt;
+    return info;
+  }
+
+  std::vector<TelemetryBlockInfo> TelemetryDecoder::ScanBlocks(
+      std::span<const std::uint8_t> stream)
+  {
+    std::vector<TelemetryBlockInfo> blocks;
+    std::size_t offset = 0;
+    while (auto info = ReadBlockInfo(stream, offset))
+    {
+      blocks.push_back(*info);
+      offset += info->size;
+    }
+    return blocks;
+  }
+
+  void TelemetryDecoder::DecodeFirst(TelemetryData &frame)
+  {
+    for (std::size_t i = 0; i < CodecState::kCounterCount; ++i)
+    {
+      state_.counters[i] = ReadBits(CodecState::kCounterBits[i]);
+      state_.deltas[i] = 0;
+    }
+
+    std::array<double, kTelemetryChannelCount> channels;
+    for (std::size_t i = 0; i < kTelemetryChannelCount; ++i)
+    {
+      state_.channels[i] = ReadBits(64);
+      state_.leading[i] = kNoWindow;
+      state_.trailing[i] = 0;
+      channels[i] = std::bit_cast<double>(state_.channels[i]);
+    }
+
+    for (std::uint8_t &flag : state_.flags)
+    {
+      flag = static_cast<std::uint8_t>(ReadBits(8));
+    }
+
+    frame.timestamp_us = state_.counters[0];
+    frame.rx_count = static_cast<std::uint32_t>(state_.counters[1]);
+    frame.tx_count = static_cast<std::uint32_t>(state_.counters[2]);
+    SetChannels(frame, channels);
+    frame.fsm = state_.flags[0];
+    frame.sensor = state_.flags[1];
+    frame.ejection = state_.flags[2];
+  }
+
+  void TelemetryDecoder::DecodeDelta(TelemetryData &frame)
+  {
+    frame.timestamp_us = ReadCounter(0);
+    frame.rx_count = static_cast<std::uint32_t>(ReadCounter(1));
+    frame.tx_count = static_cast<std::uint32_t>(ReadCounter(2));
+
+    std::array<double, kTelemetryChannelCount> channels;
+    for (std::size_t i = 0; i < kTelemetryChannelCount; ++i)
+    {
+      channels[i] = ReadChannel(i);
+    }
+    SetChannels(frame, channels);
+
+    if (ReadBits(1))
+    {
+      for (std::uint8_t &flag : state_.flags)
+      {
+        if (ReadBits(1))
+          flag = static_cast<std::uint8_t>(ReadBits(8));
+      }
+    }
+    frame.fsm = state_.flags[0];
+    frame.sensor = state_.flags[1];
+    frame.ejection = state_.flags[2];
+  }
+
+  std::uint64_t TelemetryDecoder::ReadBits(unsigned count)
+  {
+    if (count > 32)
+    {
+      std::uint64_t high = ReadBits(count - 32);
+      return (high << 32) | ReadBits(32);
+    }
+    if (count == 0)
+      return 0;
+
+    if (bit_count_ < count)
+    {
+      while (bit_count_ <= 56 && cursor_ != end_)
+      {
+        bit_buffer_ = (bit_buffer_ << 8) | *cursor_++;
+        bit_count_ += 8;
+      }
+      if (bit_count_ < count)
+      {
+        overrun_ = true;
+        return 0;
+      }
+    }
+
+    bit_count_ -= count;
+    return (bit_buffer_ >> bit_count_) & ((std::uint64_t{1} << count) - 1);
+  }
+
+  std::uint64_t TelemetryDecoder::ReadCounter(std::size_t index)
+  {
+    std::uint64_t zigzag = 0;
+    if (!ReadBits(1))
+      zigzag = 0;
+    else if (!ReadBits(1))
+      zigzag = ReadBits(7);
+    else if (!ReadBits(1))
+      zigzag = ReadBits(9);
+    else if (!ReadBits(1))
+      zigzag = ReadBits(12);
+    else
+      zigzag = ReadBits(EscapeBits(index));
+
+    std::uint64_t dod = (zigzag >> 1) ^ (~(zigzag & 1) + 1);
+    std::uint64_t delta =
+        static_cast<std::uint64_t>(state_.deltas[index]) + dod;
+    state_.deltas[index] = static_cast<std::int64_t>(delta);
+
+    std::uint64_t &counter = state_.counters[index];
+    counter += delta;
+    if (CodecState::kCounterBits[index] < 64)
+      counter &= (std::uint64_t{1} << CodecState::kCounterBits[index]) - 1;
+    return counter;
+  }
+
+  double TelemetryDecoder::ReadChannel(std::size_t index)
+  {
+    std::uint64_t &bits = state_.channels[index];
+    if (!ReadBits(1))
+      return std::bit_cast<double>(bits);
+
+    unsigned leading = state_.leading[index];
+    unsigned trailing = state_.trailing[index];
+    if (ReadBits(1))
+    {
+      auto window = static_cast<unsigned>(ReadBits(11));
+      leading = window >> 6;
+      unsigned width = (window & 0x3F) + 1;
+      if (leading + width > 64)
+      {
+        overrun_ = true;
+        return 0.0;
+      }
+      trailing = 64 - leading - width;
+      state_.leading[index] = static_cast<std::uint8_t>(leading);
+      state_.trailing[index] = static_cast<std::uint8_t>(trailing);
+    }
+    else if (leading == kNoWindow)
+    {
+      // Window reuse before any window was sent: corrupt data.
+      overrun_ = true;
+      return 0.0;
+    }
+
+    bits ^= ReadBits(64 - leading - trailing) << trailing;
+    return std::bit_cast<double>(bits);
+  }
+
+  // --- Whole-stream helpers ---
+
+  std::vector<std::uint8_t> EncodeTelemetry(
+      std::span<const TelemetryData> frames, std::size_t block_frames)
+  {
+    TelemetryEncoder encoder(block_frames);
+    encoder.Encode(frames);
+    encoder.Flush();
+    return encoder.TakeOutput();
+  }
+
+  std::vector<TelemetryData> DecodeTelemetry(
+      std::span<const std::uint8_t> stream)
+  {
+    std::size_t frame_count = 0;
+    for (const TelemetryBlockInfo &block : TelemetryDecoder::ScanBlocks(stream))
+    {
+      frame_count += block.frame_count;
+    }
+
+    std::vector<TelemetryData> frames(frame_count);
+    TelemetryDecoder decoder(stream);
+    frames.resize(decoder.Decode(std::span<TelemetryData>(frames)));
+    return frames;
+  }
+
+} // namespace gcs::data
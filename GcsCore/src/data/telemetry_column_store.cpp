@@ -0,0 +1,135 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "data/telemetry_column_store.h"
+
+#include <algorithm>
+
+namespace gcs::data
+{
+
+  namespace
+  {
+    // Scatters one field of a run of frames into a column.
+    template <typename T, typename Getter>
+    void FillColumn(T *column, std::span<const TelemetryData> frames,
+                    Getter get)
+    {
+      for (std::size_t i = 0; i < frames.size(); ++i)
+      {
+        column[i] = get(frames[i]);
+      }
+    }
+  } // namespace
+
+  void TelemetryColumnStore::Append(const TelemetryData &frame)
+  {
+    Append(std::span<const TelemetryData>(&frame, 1));
+  }
+
+  void TelemetryColumnStore::Append(std::span<const TelemetryData> frames)
+  {
+    while (!frames.empty())
+    {
+      std::size_t chunk = frame_count_ / kChunkFrames;
+      std::size_t row = frame_count_ % kChunkFrames;
+      if (chunk == chunks_.size())
+      {
+        chunks_.push_back(AllocateChunk());
+      }
+
+      std::size_t count = std::min(frames.size(), kChunkFrames - row);
+      std::span<const TelemetryData> run = frames.first(count);
+      std::byte *base = chunks_[chunk].get();
+
+      // Column by column, so each pass writes one contiguous array.
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+        FillColumn(ColumnData<double>(base, i) + row, run,
+                   [i](const TelemetryData &f)
+                   { return f.pos.data[i]; });
+        FillColumn(ColumnData<double>(base, 3 + i) + row, run,
+                   [i](const TelemetryData &f)
+                   { return f.vel.data[i]; });
+        FillColumn(ColumnData<double>(base, 6 + i) + row, run,
+                   [i](const TelemetryData &f)
+                   { return f.acc.data[i]; });
+        FillColumn(ColumnData<double>(base, 13 + i) + row, run,
+                   [i](const TelemetryData &f)
+                   { return f.euler.data[i]; });
+      }
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+        FillColumn(ColumnData<double>(base, 9 + i) + row, run,
+                   [i](const TelemetryData &f)
+                   { return f.quat.data[i]; });
+      }
+      FillColumn(ColumnData<std::uint64_t>(base, kTimestampColumn) + row, run,
+                 [](const TelemetryData &f)
+                 { return f.timestamp_us; });
+      FillColumn(ColumnData<std::uint32_t>(base, kRxCountColumn) + row, run,
+                 [](const TelemetryData &f)
+                 { return f.rx_count; });
+      FillColumn(ColumnData<std::uint32_t>(base, kTxCountColumn) + row, run,
+                 [](const TelemetryData &f)
+                 { return f.tx_count; });
+      FillColumn(ColumnData<std::uint8_t>(base, kFsmColumn) + row, run,
+                 [](const TelemetryData &f)
+                 { return f.fsm; });
+      FillColumn(ColumnData<std::uint8_t>(base, kSensorColumn) + row, run,
+                 [](const TelemetryData &f)
+                 { return f.sensor; });
+      FillColumn(ColumnData<std::uint8_t>(base, kEjectionColumn) + row, run,
+                 [](const TelemetryData &f)
+                 { return f.ejection; });
+
+      frame_count_ += count;
+      frames = frames.subspan(count);
+    }
+  }
+
+  void TelemetryColumnStore::Reserve(std::size_t frame_count)
+  {
+    std::size_t needed = (frame_count + kChunkFrames - 1) / kChunkFrames;
+    chunks_.reserve(needed);
+    while (chunks_.size() < needed)
+    {
+      chunks_.push_back(AllocateChunk());
+    }
+  }
+
+  void TelemetryColumnStore::Clear()
+  {
+    chunks_.clear();
+    frame_count_ = 0;
+  }
+
+  TelemetryData TelemetryColumnStore::GetFrame(std::size_t index) const
+  {
+    std::byte *base = chunks_[index / kChunkFrames].get();
+    std::size_t row = index % kChunkFrames;
+
+    TelemetryData frame;
+    for (std::size_t i = 0; i < kTelemetryChannelCount; ++i)
+    {
+      SetChannelValue(frame, static_cast<TelemetryChannel>(i),
+                      ColumnData<double>(base, i)[row]);
+    }
+    frame.timestamp_us =
+        ColumnData<std::uint64_t>(base, kTimestampColumn)[row];
+    frame.rx_count = ColumnData<std::uint32_t>(base, kRxCountColumn)[row];
+    frame.tx_count = ColumnData<std::uint32_t>(base, kTxCountColumn)[row];
+    frame.fsm = ColumnData<std::uint8_t>(base, kFsmColumn)[row];
+    frame.sensor = ColumnData<std::uint8_t>(base, kSensorColumn)[row];
+    frame.ejection = ColumnData<std::uint8_t>(base, kEjectionColumn)[row];
+    return frame;
+  }
+
+  TelemetryColumnStore::ChunkPtr TelemetryColumnStore::AllocateChunk()
+  {
+    return ChunkPtr(static_cast<std::byte *>(::operator new[](
+        kColumnOffsets[kColumnCount], std::align_val_t(kColumnAlignment))));
+  }
+
+} // namespace gcs::data
@@ -0,0 +1,138 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "data/telemetry_history.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace gcs::data
+{
+
+  TelemetryHistory::TelemetryHistory(std::size_t capacity)
+      : mask_(std::bit_ceil(std::max<std::size_t>(capacity, 1)) - 1),
+        slots_(std::make_unique<gcs::common::SeqLock<TelemetryData>[]>(
+            mask_ + 1))
+  {
+  }
+
+  void TelemetryHistory::Publish(const TelemetryData &frame)
+  {
+    std::uint64_t sequence = published_.load(std::memory_order_relaxed);
+    slots_[sequence & mask_].Store(frame);
+    published_.store(sequence + 1, std::memory_order_release);
+  }
+
+  void TelemetryHistory::Publish(std::span<const TelemetryData> frames)
+  {
+    std::uint64_t sequence = published_.load(std::memory_order_relaxed);
+    for (const TelemetryData &frame : frames)
+    {
+      slots_[sequence++ & mask_].Store(frame);
+    }
+    published_.store(sequence, std::memory_order_release);
+  }
+
+  bool TelemetryHistory::Read(std::uint64_t sequence,
+                              TelemetryData &frame) const
+  {
+    std::uint64_t published = published_.load(std::memory_order_acquire);
+    if (sequence >= published || published - sequence > GetCapacity())
+      return false;
+
+    // Slot i holds frames i, i + capacity, ...; frame n is the slot's
+    // (n / capacity + 1)-th store, and every store advances the SeqLock
+    // sequence by 2.
+    std::uint64_t expected = 2 * (sequence / GetCapacity() + 1);
+    return slots_[sequence & mask_].Load(frame) == expected;
+  }
+
+  bool TelemetryHistory::ReadLatest(TelemetryData &frame) const
+  {
+    // Only fails if the producer laps the reader within one read.
+    std::uint64_t published;
+    while ((published = GetPublishedCount()) != 0)
+    {
+      if (Read(published - 1, frame))
+        return true;
+    }
+    return false;
+  }
+
+  std::size_t TelemetryHistory::CopyLatest(
+      std::size_t count, std::vector<TelemetryData> &out) const
+  {
+    out.clear();
+    std::uint64_t published = GetPublishedCount();
+    std::uint64_t available = std::min<std::uint64_t>(
+        {count, GetCapacity(), published});
+    out.reserve(available);
+
+    TelemetryData frame;
+    for (std::uint64_t seq = published - available; seq < published; ++seq)
+    {
+      // The producer overwrites oldest first, so everything read so far is
+      // older than a lost frame and goes too.
+      if (!Read(seq, frame))
+      {
+        out.clear();
+        continue;
+      }
+      out.push_back(frame);
+    }
+    return out.size();
+  }
+
+  std::size_t TelemetryHistory::CopyRecent(
+      std::chrono::microseconds window, std::vector<TelemetryData> &out) const
+  {
+    out.clear();
+    std::uint64_t published = GetPublishedCount();
+    std::uint64_t oldest =
+        published > GetCapacity() ? published - GetCapacity() : 0;
+    auto window_us = static_cast<std::uint64_t>(window.count());
+
+    // Walk back from the newest frame until the window is covered or the
+    // next older frame has been overwritten.
+    TelemetryData frame;
+    std::uint64_t newest = 0;
+    for (std::uint64_t seq = published; seq > oldest; --seq)
+    {
+      if (!Read(seq - 1, frame))
+        break;
+      if (out.empty())
+        newest = frame.timestamp_us;
+      else if (newest - frame.timestamp_us > window_us)
+        break;
+      out.push_back(frame);
+    }
+    std::reverse(out.begin(), out.end());
+    return out.size();
+  }
+
+  std::uint64_t TelemetryHistory::ReadSince(
+      std::uint64_t &cursor, std::vector<TelemetryData> &out) const
+  {
+    std::uint64_t published = GetPublishedCount();
+    std::uint64_t oldest =
+        published > GetCapacity() ? published - GetCapacity() : 0;
+    std::uint64_t dropped = 0;
+    if (cursor < oldest)
+    {
+      dropped = oldest - cursor;
+      cursor = oldest;
+    }
+
+    TelemetryData frame;
+    for (; cursor < published; ++cursor)
+    {
+      if (Read(cursor, frame))
+        out.push_back(frame);
+      else
+        ++dropped;
+    }
+    return dropped;
+  }
+
+} // namespace gcs::data
@@ -0,0 +1,892 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "data/telemetry_math.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <initializer_list>
+#include <stdexcept>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || \
+    defined(__i386__)
+#define GCS_MATH_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define GCS_MATH_X86 0
+#endif
+
+// GCC and Clang only emit instructions of the enabled target; MSVC accepts
+// the intrinsics anywhere.
+#if GCS_MATH_X86 && (defined(__GNUC__) || defined(__clang__))
+#define GCS_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define GCS_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define GCS_TARGET_SSE41
+#define GCS_TARGET_AVX2
+#endif
+
+namespace gcs::data
+{
+
+  namespace
+  {
+    // Frames gathered into columns per pass of the frame kernels.
+    constexpr std::size_t kFrameBlock = 256;
+
+    // Above this |cos(angle)| the sine ratios of SLERP lose precision.
+    constexpr double kSlerpLinearDot = 0.9995;
+
+    SimdLevel DetectSimdLevel()
+    {
+#if GCS_MATH_X86
+#if defined(_MSC_VER)
+      int info[4] = {};
+      __cpuid(info, 0);
+      int max_leaf = info[0];
+      __cpuid(info, 1);
+      bool sse41 = (info[2] & (1 << 19)) != 0;
+      bool osxsave = (info[2] & (1 << 27)) != 0;
+      bool avx = (info[2] & (1 << 28)) != 0;
+      bool avx2 = false;
+      if (max_leaf >= 7 && osxsave && avx &&
+          (_xgetbv(0) & 0x6) == 0x6) // XMM and YMM state enabled by the OS.
+      {
+        __cpuidex(info, 7, 0);
+        avx2 = (info[1] & (1 << 5)) != 0;
+      }
+#else
+      __builtin_cpu_init();
+      bool sse41 = __builtin_cpu_supports("sse4.1");
+      bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+      if (avx2)
+        return SimdLevel::kAvx2;
+      if (sse41)
+        return SimdLevel::kSse4;
+#endif
+      return SimdLevel::kScalar;
+    }
+
+    std::atomic<SimdLevel> &ActiveLevel()
+    {
+      static std::atomic<SimdLevel> level(GetSupportedSimdLevel());
+      return level;
+    }
+
+    void CheckSizes(std::size_t expected, std::initializer_list<std::size_t> sizes)
+    {
+      for (std::size_t size : sizes)
+      {
+        if (size != expected)
+        {
+          throw std::invalid_argument("Column lengths must match");
+        }
+      }
+    }
+
+    // --- Scalar per-element operations (the reference) ---
+
+    inline void NormalizeOne(double &w, double &x, double &y, double &z)
+    {
+      double norm = std::sqrt(w * w + x * x + y * y + z * z);
+      if (norm > 0.0)
+      {
+        w = w / norm;
+        x = x / norm;
+        y = y / norm;
+        z = z / norm;
+      }
+    }
+
+    inline void EulerOne(double w, double x, double y, double z, double &roll,
+                         double &pitch, double &yaw)
+    {
+      double sin_roll = 2.0 * (w * x + y * z);
+      double cos_roll = 1.0 - 2.0 * (x * x + y * y);
+      double sin_pitch = 2.0 * (w * y - z * x);
+      if (sin_pitch > 1.0)
+        sin_pitch = 1.0;
+      else if (sin_pitch < -1.0)
+        sin_pitch = -1.0;
+      double sin_yaw = 2.0 * (w * z + x * y);
+      double cos_yaw = 1.0 - 2.0 * (y * y + z * z);
+      roll = std::atan2(sin_roll, cos_roll);
+      pitch = std::asin(sin_pitch);
+      yaw = std::atan2(sin_yaw, cos_yaw);
+    }
+
+    // v' = v + w * t + u x t, with t = 2 * (u x v) and u = (x, y, z).
+    inline void RotateOne(double w, double x, double y, double z, double vx,
+                          double vy, double vz, double &ox, double &oy,
+                          double &oz)
+    {
+      double tx = 2.0 * (y * vz - z * vy);
+      double ty = 2.0 * (z * vx - x * vz);
+      double tz = 2.0 * (x * vy - y * vx);
+      ox = vx + w * tx + (y * tz - z * ty);
+      oy = vy + w * ty + (z * tx - x * tz);
+      oz = vz + w * tz + (x * ty - y * tx);
+    }
+
+    inline double NormOne(double x, double y, double z)
+    {
+      return std::sqrt(x * x + y * y + z * z);
+    }
+
+    inline double LerpOne(double from, double to, double t)
+    {
+      return from * (1.0 - t) + to * t;
+    }
+
+    inline double DotOne(double aw, double ax, double ay, double az, double bw,
+                         double bx, double by, double bz)
+    {
+      return aw * bw + ax * bx + ay * by + az * bz;
+    }
+
+    // Weights of from and to for SLERP given their dot product. The sign of
+    // from's weight keeps the interpolation on the shorter arc.
+    inline void SlerpWeights(double dot, double t, double &wa, double &wb)
+    {
+      double sign = 1.0;
+      if (dot < 0.0)
+      {
+        dot = -dot;
+        sign = -1.0;
+      }
+      if (dot > kSlerpLinearDot)
+      {
+        // |(1 - t) a + t b|^2 of unit quaternions depends only on the dot.
+        wa = 1.0 - t;
+        wb = t;
+        double norm = std::sqrt(wa * wa + wb * wb + 2.0 * wa * wb * dot);
+        wa = wa / norm;
+        wb = wb / norm;
+      }
+      else
+      {
+        double angle = std::acos(dot);
+        double sin_angle = std::sin(angle);
+        wa = std::sin((1.0 - t) * angle) / sin_angle;
+        wb = std::sin(t * angle) / sin_angle;
+      }
+      wa = sign * wa;
+    }
+
+    // --- Scalar range kernels, also used for the tails of vector loops ---
+
+    void NormalizeScalar(QuatColumns q, std::size_t begin)
+    {
+      for (std::size_t i = begin; i < q.w.size(); ++i)
+      {
+        NormalizeOne(q.w[i], q.x[i], q.y[i], q.z[i]);
+      }
+    }
+
+    void EulerScalar(ConstQuatColumns q, Vec3Columns e, std::size_t begin)
+    {
+      for (std::size_t i = begin; i < q.w.size(); ++i)
+      {
+        EulerOne(q.w[i], q.x[i], q.y[i], q.z[i], e.x[i], e.y[i], e.z[i]);
+      }
+    }
+
+    void RotateScalar(ConstQuatColumns q, ConstVec3Columns v, Vec3Columns o,
+                      std::size_t begin)
+    {
+      for (std::size_t i = begin; i < q.w.size(); ++i)
+      {
+        RotateOne(q.w[i], q.x[i], q.y[i], q.z[i], v.x[i], v.y[i], v.z[i],
+                  o.x[i], o.y[i], o.z[i]);
+      }
+    }
+
+    void NormsScalar(ConstVec3Columns v, std::span<double> norms,
+                     std::size_t begin)
+    {
+      for (std::size_t i = begin; i < norms.size(); ++i)
+      {
+        norms[i] = NormOne(v.x[i], v.y[i], v.z[i]);
+      }
+    }
+
+    void LerpScalar(std::span<const double> a, std::span<const double> b,
+                    std::span<const double> t, std::span<double> o,
+                    std::size_t begin)
+    {
+      for (std::size_t i = begin; i < o.size(); ++i)
+      {
+        o[i] = LerpOne(a[i], b[i], t[i]);
+      }
+    }
+
+    void SlerpScalar(ConstQuatColumns a, ConstQuatColumns b,
+                     std::span<const double> t, QuatColumns o,
+                     std::size_t begin)
+    {
+      for (std::size_t i = begin; i < o.w.size(); ++i)
+      {
+        double wa, wb;
+        SlerpWeights(DotOne(a.w[i], a.x[i], a.y[i], a.z[i], b.w[i], b.x[i],
+                            b.y[i], b.z[i]),
+                     t[i], wa, wb);
+        double w = wa * a.w[i] + wb * b.w[i];
+        double x = wa * a.x[i] + wb * b.x[i];
+        double y = wa * a.y[i] + wb * b.y[i];
+        double z = wa * a.z[i] + wb * b.z[i];
+        o.w[i] = w;
+        o.x[i] = x;
+        o.y[i] = y;
+        o.z[i] = z;
+      }
+    }
+
+#if GCS_MATH_X86
+    // --- SSE4.1 kernels; each returns the number of elements processed ---
+
+    GCS_TARGET_SSE41 std::size_t NormalizeSse4(QuatColumns q)
+    {
+      const __m128d zero = _mm_setzero_pd();
+      std::size_t n = q.w.size() & ~std::size_t(1);
+      for (std::size_t i = 0; i < n; i += 2)
+      {
+        __m128d w = _mm_loadu_pd(&q.w[i]);
+        __m128d x = _mm_loadu_pd(&q.x[i]);
+        __m128d y = _mm_loadu_pd(&q.y[i]);
+        __m128d z = _mm_loadu_pd(&q.z[i]);
+        __m128d sum = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(w, w),
+                                                       _mm_mul_pd(x, x)),
+                                            _mm_mul_pd(y, y)),
+                                 _mm_mul_pd(z, z));
+        __m128d norm = _mm_sqrt_pd(sum);
+        __m128d valid = _mm_cmpgt_pd(norm, zero);
+        _mm_storeu_pd(&q.w[i], _mm_blendv_pd(w, _mm_div_pd(w, norm), valid));
+        _mm_storeu_pd(&q.x[i], _mm_blendv_pd(x, _mm_div_pd(x, norm), valid));
+        _mm_storeu_pd(&q.y[i], _mm_blendv_pd(y, _mm_div_pd(y, norm), valid));
+        _mm_storeu_pd(&q.z[i], _mm_blendv_pd(z, _mm_div_pd(z, norm), valid));
+      }
+      return n;
+    }
+
+    GCS_TARGET_SSE41 std::size_t EulerSse4(ConstQuatColumns q, Vec3Columns e)
+    {
+      const __m128d one = _mm_set1_pd(1.0);
+      const __m128d minus_one = _mm_set1_pd(-1.0);
+      const __m128d two = _mm_set1_pd(2.0);
+      alignas(16) double sin_roll[2], cos_roll[2], sin_pitch[2], sin_yaw[2],
+          cos_yaw[2];
+      std::size_t n = q.w.size() & ~std::size_t(1);
+      for (std::size_t i = 0; i < n; i += 2)
+      {
+        __m128d w = _mm_loadu_pd(&q.w[i]);
+        __m128d x = _mm_loadu_pd(&q.x[i]);
+        __m128d y = _mm_loadu_pd(&q.y[i]);
+        __m128d z = _mm_loadu_pd(&q.z[i]);
+        _mm_store_pd(sin_roll, _mm_mul_pd(two, _mm_add_pd(_mm_mul_pd(w, x),
+                                                          _mm_mul_pd(y, z))));
+        _mm_store_pd(cos_roll,
+                     _mm_sub_pd(one, _mm_mul_pd(two, _mm_add_pd(_mm_mul_pd(x, x),
+                                                                _mm_mul_pd(y, y)))));
+        __m128d sp = _mm_mul_pd(two, _mm_sub_pd(_mm_mul_pd(w, y),
+                                                _mm_mul_pd(z, x)));
+        // Operand order keeps NaN inputs NaN, like the scalar clamp.
+        _mm_store_pd(sin_pitch, _mm_min_pd(one, _mm_max_pd(minus_one, sp)));
+        _mm_store_pd(sin_yaw, _mm_mul_pd(two, _mm_add_pd(_mm_mul_pd(w, z),
+                                                         _mm_mul_pd(x, y))));
+        _mm_store_pd(cos_yaw,
+                     _mm_sub_pd(one, _mm_mul_pd(two, _mm_add_pd(_mm_mul_pd(y, y),
+                                                                _mm_mul_pd(z, z)))));
+        for (std::size_t lane = 0; lane < 2; ++lane)
+        {
+          e.x[i + lane] = std::atan2(sin_roll[lane], cos_roll[lane]);
+          e.y[i + lane] = std::asin(sin_pitch[lane]);
+          e.z[i + lane] = std::atan2(sin_yaw[lane], cos_yaw[lane]);
+        }
+      }
+      return n;
+    }
+
+    GCS_TARGET_SSE41 std::size_t RotateSse4(ConstQuatColumns q,
+                                            ConstVec3Columns v, Vec3Columns o)
+    {
+      const __m128d two = _mm_set1_pd(2.0);
+      std::size_t n = q.w.size() & ~std::size_t(1);
+      for (std::size_t i = 0; i < n; i += 2)
+      {
+        __m128d w = _mm_loadu_pd(&q.w[i]);
+        __m128d x = _mm_loadu_pd(&q.x[i]);
+        __m128d y = _mm_loadu_pd(&q.y[i]);
+        __m128d z = _mm_loadu_pd(&q.z[i]);
+        __m128d vx = _mm_loadu_pd(&v.x[i]);
+        __m128d vy = _mm_loadu_pd(&v.y[i]);
+        __m128d vz = _mm_loadu_pd(&v.z[i]);
+        __m128d tx = _mm_mul_pd(two, _mm_sub_pd(_mm_mul_pd(y, vz), _mm_mul_pd(z, vy)));
+        __m128d ty = _mm_mul_pd(two, _mm_sub_pd(_mm_mul_pd(z, vx), _mm_mul_pd(x, vz)));
+        __m128d tz = _mm_mul_pd(two, _mm_sub_pd(_mm_mul_pd(x, vy), _mm_mul_pd(y, vx)));
+        __m128d ox = _mm_add_pd(_mm_add_pd(vx, _mm_mul_pd(w, tx)),
+                                _mm_sub_pd(_mm_mul_pd(y, tz), _mm_mul_pd(z, ty)));
+        __m128d oy = _mm_add_pd(_mm_add_pd(vy, _mm_mul_pd(w, ty)),
+                                _mm_sub_pd(_mm_mul_pd(z, tx), _mm_mul_pd(x, tz)));
+        __m128d oz = _mm_add_pd(_mm_add_pd(vz, _mm_mul_pd(w, tz)),
+                                _mm_sub_pd(_mm_mul_pd(x, ty), _mm_mul_pd(y, tx)));
+        _mm_storeu_pd(&o.x[i], ox);
+        _mm_storeu_pd(&o.y[i], oy);
+        _mm_storeu_pd(&o.z[i], oz);
+      }
+      return n;
+    }
+
+    GCS_TARGET_SSE41 std::size_t NormsSse4(ConstVec3Columns v,
+                                           std::span<double> norms)
+    {
+      std::size_t n = norms.size() & ~std::size_t(1);
+      for (std::size_t i = 0; i < n; i += 2)
+      {
+        __m128d x = _mm_loadu_pd(&v.x[i]);
+        __m128d y = _mm_loadu_pd(&v.y[i]);
+        __m128d z = _mm_loadu_pd(&v.z[i]);
+        __m128d sum = _mm_add_pd(_mm_add_pd(_mm_mul_pd(x, x), _mm_mul_pd(y, y)),
+                                 _mm_mul_pd(z, z));
+        _mm_storeu_pd(&norms[i], _mm_sqrt_pd(sum));
+      }
+      return n;
+    }
+
+    GCS_TARGET_SSE41 std::size_t LerpSse4(std::span<const double> a,
+                                          std::span<const double> b,
+                                          std::span<const double> t,
+                                          std::span<double> o)
+    {
+      const __m128d one = _mm_set1_pd(1.0);
+      std::size_t n = o.size() & ~std::size_t(1);
+      for (std::size_t i = 0; i < n; i += 2)
+      {
+        __m128d weight = _mm_loadu_pd(&t[i]);
+        __m128d from = _mm_mul_pd(_mm_loadu_pd(&a[i]), _mm_sub_pd(one, weight));
+        __m128d to = _mm_mul_pd(_mm_loadu_pd(&b[i]), weight);
+        _mm_storeu_pd(&o[i], _mm_add_pd(from, to));
+      }
+      return n;
+    }
+
+    GCS_TARGET_SSE41 std::size_t SlerpSse4(ConstQuatColumns a,
+                                           ConstQuatColumns b,
+                                           std::span<const double> t,
+                                           QuatColumns o)
+    {
+      alignas(16) double dot[2], weight_a[2], weight_b[2];
+      std::size_t n = o.w.size() & ~std::size_t(1);
+      for (std::size_t i = 0; i < n; i += 2)
+      {
+        __m128d aw = _mm_loadu_pd(&a.w[i]);
+        __m128d ax = _mm_loadu_pd(&a.x[i]);
+        __m128d ay = _mm_loadu_pd(&a.y[i]);
+        __m128d az = _mm_loadu_pd(&a.z[i]);
+        __m128d bw = _mm_loadu_pd(&b.w[i]);
+        __m128d bx = _mm_loadu_pd(&b.x[i]);
+        __m128d by = _mm_loadu_pd(&b.y[i]);
+        __m128d bz = _mm_loadu_pd(&b.z[i]);
+        _mm_store_pd(dot, _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(aw, bw),
+                                                           _mm_mul_pd(ax, bx)),
+                                                _mm_mul_pd(ay, by)),
+                                     _mm_mul_pd(az, bz)));
+        for (std::size_t lane = 0; lane < 2; ++lane)
+        {
+          SlerpWeights(dot[lane], t[i + lane], weight_a[lane], weight_b[lane]);
+        }
+        __m128d wa = _mm_load_pd(weight_a);
+        __m128d wb = _mm_load_pd(weight_b);
+        _mm_storeu_pd(&o.w[i], _mm_add_pd(_mm_mul_pd(wa, aw),
+                                          _mm_mul_pd(wb, bw)));
+        _mm_storeu_pd(&o.x[i], _mm_add_pd(_mm_mul_pd(wa, ax),
+                                          _mm_mul_pd(wb, bx)));
+        _mm_storeu_pd(&o.y[i], _mm_add_pd(_mm_mul_pd(wa, ay),
+                                          _mm_mul_pd(wb, by)));
+        _mm_storeu_pd(&o.z[i], _mm_add_pd(_mm_mul_pd(wa, az),
+                                          _mm_mul_pd(wb, bz)));
+      }
+      return n;
+    }
+
+    // --- AVX2 kernels ---
+
+    GCS_TARGET_AVX2 std::size_t NormalizeAvx2(QuatColumns q)
+    {
+      const __m256d zero = _mm256_setzero_pd();
+      std::size_t n = q.w.size() & ~std::size_t(3);
+      for (std::size_t i = 0; i < n; i += 4)
+      {
+        __m256d w = _mm256_loadu_pd(&q.w[i]);
+        __m256d x = _mm256_loadu_pd(&q.x[i]);
+        __m256d y = _mm256_loadu_pd(&q.y[i]);
+        __m256d z = _mm256_loadu_pd(&q.z[i]);
+        __m256d sum = _mm256_add_pd(
+            _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(w, w), _mm256_mul_pd(x, x)),
+                          _mm256_mul_pd(y, y)),
+            _mm256_mul_pd(z, z));
+        __m256d norm = _mm256_sqrt_pd(sum);
+        __m256d valid = _mm256_cmp_pd(norm, zero, _CMP_GT_OQ);
+        _mm256_storeu_pd(&q.w[i], _mm256_blendv_pd(w, _mm256_div_pd(w, norm), valid));
+        _mm256_storeu_pd(&q.x[i], _mm256_blendv_pd(x, _mm256_div_pd(x, norm), valid));
+        _mm256_storeu_pd(&q.y[i], _mm256_blendv_pd(y, _mm256_div_pd(y, norm), valid));
+        _mm256_storeu_pd(&q.z[i], _mm256_blendv_pd(z, _mm256_div_pd(z, norm), valid));
+      }
+      return n;
+    }
+
+    GCS_TARGET_AVX2 std::size_t EulerAvx2(ConstQuatColumns q, Vec3Columns e)
+    {
+      const __m256d one = _mm256_set1_pd(1.0);
+      const __m256d minus_one = _mm256_set1_pd(-1.0);
+      const __m256d two = _mm256_set1_pd(2.0);
+      alignas(32) double sin_roll[4], cos_roll[4], sin_pitch[4], sin_yaw[4],
+          cos_yaw[4];
+      std::size_t n = q.w.size() & ~std::size_t(3);
+      for (std::size_t i = 0; i < n; i += 4)
+      {
+        __m256d w = _mm256_loadu_pd(&q.w[i]);
+        __m256d x = _mm256_loadu_pd(&q.x[i]);
+        __m256d y = _mm256_loadu_pd(&q.y[i]);
+        __m256d z = _mm256_loadu_pd(&q.z[i]);
+        _mm256_store_pd(sin_roll,
+                        _mm256_mul_pd(two, _mm256_add_pd(_mm256_mul_pd(w, x),
+                                                         _mm256_mul_pd(y, z))));
+        _mm256_store_pd(cos_roll,
+                        _mm256_sub_pd(one, _mm256_mul_pd(two, _mm256_add_pd(_mm256_mul_pd(x, x),
+                                                                            _mm256_mul_pd(y, y)))));
+        __m256d sp = _mm256_mul_pd(two, _mm256_sub_pd(_mm256_mul_pd(w, y),
+                                                      _mm256_mul_pd(z, x)));
+        _mm256_store_pd(sin_pitch, _mm256_min_pd(one, _mm256_max_pd(minus_one, sp)));
+        _mm256_store_pd(sin_yaw,
+                        _mm256_mul_pd(two, _mm256_add_pd(_mm256_mul_pd(w, z),
+                                                         _mm256_mul_pd(x, y))));
+        _mm256_store_pd(cos_yaw,
+                        _mm256_sub_pd(one, _mm256_mul_pd(two, _mm256_add_pd(_mm256_mul_pd(y, y),
+                                                                            _mm256_mul_pd(z, z)))));
+        for (std::size_t lane = 0; lane < 4; ++lane)
+        {
+          e.x[i + lane] = std::atan2(sin_roll[lane], cos_roll[lane]);
+          e.y[i + lane] = std::asin(sin_pitch[lane]);
+          e.z[i + lane] = std::atan2(sin_yaw[lane], cos_yaw[lane]);
+        }
+      }
+      return n;
+    }
+
+    GCS_TARGET_AVX2 std::size_t RotateAvx2(ConstQuatColumns q,
+                                           ConstVec3Columns v, Vec3Columns o)
+    {
+      const __m256d two = _mm256_set1_pd(2.0);
+      std::size_t n = q.w.size() & ~std::size_t(3);
+      for (std::size_t i = 0; i < n; i += 4)
+      {
+        __m256d w = _mm256_loadu_pd(&q.w[i]);
+        __m256d x = _mm256_loadu_pd(&q.x[i]);
+        __m256d y = _mm256_loadu_pd(&q.y[i]);
+        __m256d z = _mm256_loadu_pd(&q.z[i]);
+        __m256d vx = _mm256_loadu_pd(&v.x[i]);
+        __m256d vy = _mm256_loadu_pd(&v.y[i]);
+        __m256d vz = _mm256_loadu_pd(&v.z[i]);
+        __m256d tx = _mm256_mul_pd(two, _mm256_sub_pd(_mm256_mul_pd(y, vz), _mm256_mul_pd(z, vy)));
+        __m256d ty = _mm256_mul_pd(two, _mm256_sub_pd(_mm256_mul_pd(z, vx), _mm256_mul_pd(x, vz)));
+        __m256d tz = _mm256_mul_pd(two, _mm256_sub_pd(_mm256_mul_pd(x, vy), _mm256_mul_pd(y, vx)));
+        __m256d ox = _mm256_add_pd(_mm256_add_pd(vx, _mm256_mul_pd(w, tx)),
+                                   _mm256_sub_pd(_mm256_mul_pd(y, tz), _mm256_mul_pd(z, ty)));
+        __m256d oy = _mm256_add_pd(_mm256_add_pd(vy, _mm256_mul_pd(w, ty)),
+                                   _mm256_sub_pd(_mm256_mul_pd(z, tx), _mm256_mul_pd(x, tz)));
+        __m256d oz = _mm256_add_pd(_mm256_add_pd(vz, _mm256_mul_pd(w, tz)),
+                                   _mm256_sub_pd(_mm256_mul_pd(x, ty), _mm256_mul_pd(y, tx)));
+        _mm256_storeu_pd(&o.x[i], ox);
+        _mm256_storeu_pd(&o.y[i], oy);
+        _mm256_storeu_pd(&o.z[i], oz);
+      }
+      return n;
+    }
+
+    GCS_TARGET_AVX2 std::size_t NormsAvx2(ConstVec3Columns v,
+                                          std::span<double> norms)
+    {
+      std::size_t n = norms.size() & ~std::size_t(3);
+      for (std::size_t i = 0; i < n; i += 4)
+      {
+        __m256d x = _mm256_loadu_pd(&v.x[i]);
+        __m256d y = _mm256_loadu_pd(&v.y[i]);
+        __m256d z = _mm256_loadu_pd(&v.z[i]);
+        __m256d sum = _mm256_add_pd(
+            _mm256_add_pd(_mm256_mul_pd(x, x), _mm256_mul_pd(y, y)),
+            _mm256_mul_pd(z, z));
+        _mm256_storeu_pd(&norms[i], _mm256_sqrt_pd(sum));
+      }
+      return n;
+    }
+
+    GCS_TARGET_AVX2 std::size_t LerpAvx2(std::span<const double> a,
+                                         std::span<const double> b,
+                                         std::span<const double> t,
+                                         std::span<double> o)
+    {
+      const __m256d one = _mm256_set1_pd(1.0);
+      std::size_t n = o.size() & ~std::size_t(3);
+      for (std::size_t i = 0; i < n; i += 4)
+      {
+        __m256d weight = _mm256_loadu_pd(&t[i]);
+        __m256d from = _mm256_mul_pd(_mm256_loadu_pd(&a[i]),
+                                     _mm256_sub_pd(one, weight));
+        __m256d to = _mm256_mul_pd(_mm256_loadu_pd(&b[i]), weight);
+        _mm256_storeu_pd(&o[i], _mm256_add_pd(from, to));
+      }
+      return n;
+    }
+
+    GCS_TARGET_AVX2 std::size_t SlerpAvx2(ConstQuatColumns a,
+                                          ConstQuatColumns b,
+                                          std::span<const double> t,
+                                          QuatColumns o)
+    {
+      alignas(32) double dot[4], weight_a[4], weight_b[4];
+      std::size_t n = o.w.size() & ~std::size_t(3);
+      for (std::size_t i = 0; i < n; i += 4)
+      {
+        __m256d aw = _mm256_loadu_pd(&a.w[i]);
+        __m256d ax = _mm256_loadu_pd(&a.x[i]);
+        __m256d ay = _mm256_loadu_pd(&a.y[i]);
+        __m256d az = _mm256_loadu_pd(&a.z[i]);
+        __m256d bw = _mm256_loadu_pd(&b.w[i]);
+        __m256d bx = _mm256_loadu_pd(&b.x[i]);
+        __m256d by = _mm256_loadu_pd(&b.y[i]);
+        __m256d bz = _mm256_loadu_pd(&b.z[i]);
+        _mm256_store_pd(dot, _mm256_add_pd(
+                                 _mm256_add_pd(
+                                     _mm256_add_pd(_mm256_mul_pd(aw, bw),
+                                                   _mm256_mul_pd(ax, bx)),
+                                     _mm256_mul_pd(ay, by)),
+                                 _mm256_mul_pd(az, bz)));
+        // The trigonometry has no vector form; only the weights are scalar.
+        for (std::size_t lane = 0; lane < 4; ++lane)
+        {
+          SlerpWeights(dot[lane], t[i + lane], weight_a[lane], weight_b[lane]);
+        }
+        __m256d wa = _mm256_load_pd(weight_a);
+        __m256d wb = _mm256_load_pd(weight_b);
+        _mm256_storeu_pd(&o.w[i], _mm256_add_pd(_mm256_mul_pd(wa, aw),
+                                                _mm256_mul_pd(wb, bw)));
+        _mm256_storeu_pd(&o.x[i], _mm256_add_pd(_mm256_mul_pd(wa, ax),
+                                                _mm256_mul_pd(wb, bx)));
+        _mm256_storeu_pd(&o.y[i], _mm256_add_pd(_mm256_mul_pd(wa, ay),
+                                                _mm256_mul_pd(wb, by)));
+        _mm256_storeu_pd(&o.z[i], _mm256_add_pd(_mm256_mul_pd(wa, az),
+                                                _mm256_mul_pd(wb, bz)));
+      }
+      return n;
+    }
+#endif // GCS_MATH_X86
+
+    /**
+     * @brief Scratch columns for running the column kernels over a block of
+     * frames.
+     */
+    struct FrameBlock
+    {
+      std::array<double, kFrameBlock> w, x, y, z;
+      std::array<double, kFrameBlock> vx, vy, vz;
+
+      QuatColumns Quat(std::size_t count)
+      {
+        return {{w.data(), count}, {x.data(), count}, {y.data(), count},
+                {z.data(), count}};
+      }
+
+      Vec3Columns Vec(std::size_t count)
+      {
+        return {{vx.data(), count}, {vy.data(), count}, {vz.data(), count}};
+      }
+
+      void LoadQuat(std::span<const TelemetryData> frames)
+      {
+        for (std::size_t i = 0; i < frames.size(); ++i)
+        {
+          w[i] = frames[i].quat.data[0];
+          x[i] = frames[i].quat.data[1];
+          y[i] = frames[i].quat.data[2];
+          z[i] = frames[i].quat.data[3];
+        }
+      }
+    };
+
+  } // namespace
+
+  SimdLevel GetSupportedSimdLevel()
+  {
+    static const SimdLevel supported = DetectSimdLevel();
+    return supported;
+  }
+
+  SimdLevel GetSimdLevel()
+  {
+    return ActiveLevel().load(std::memory_order_relaxed);
+  }
+
+  void SetSimdLevel(SimdLevel level)
+  {
+    ActiveLevel().store(std::min(level, GetSupportedSimdLevel()),
+                        std::memory_order_relaxed);
+  }
+
+  void NormalizeQuaternions(QuatColumns quat)
+  {
+    CheckSizes(quat.w.size(), {quat.x.size(), quat.y.size(), quat.z.size()});
+    std::size_t done = 0;
+#if GCS_MATH_X86
+    switch (GetSimdLevel())
+    {
+    case SimdLevel::kAvx2:
+      done = NormalizeAvx2(quat);
+      break;
+    case SimdLevel::kSse4:
+      done = NormalizeSse4(quat);
+      break;
+    case SimdLevel::kScalar:
+      break;
+    }
+#endif
+    NormalizeScalar(quat, done);
+  }
+
+  void QuaternionsToEuler(ConstQuatColumns quat, Vec3Columns euler)
+  {
+    CheckSizes(quat.w.size(), {quat.x.size(), quat.y.size(), quat.z.size(),
+                               euler.x.size(), euler.y.size(), euler.z.size()});
+    std::size_t done = 0;
+#if GCS_MATH_X86
+    switch (GetSimdLevel())
+    {
+    case SimdLevel::kAvx2:
+      done = EulerAvx2(quat, euler);
+      break;
+    case SimdLevel::kSse4:
+      done = EulerSse4(quat, euler);
+      break;
+    case SimdLevel::kScalar:
+      break;
+    }
+#endif
+    EulerScalar(quat, euler, done);
+  }
+
+  void RotateToWorld(ConstQuatColumns quat, ConstVec3Columns body,
+                     Vec3Columns world)
+  {
+    CheckSizes(quat.w.size(), {quat.x.size(), quat.y.size(), quat.z.size(),
+                               body.x.size(), body.y.size(), body.z.size(),
+                               world.x.size(), world.y.size(), world.z.size()});
+    std::size_t done = 0;
+#if GCS_MATH_X86
+    switch (GetSimdLevel())
+    {
+    case SimdLevel::kAvx2:
+      done = RotateAvx2(quat, body, world);
+      break;
+    case SimdLevel::kSse4:
+      done = RotateSse4(quat, body, world);
+      break;
+    case SimdLevel::kScalar:
+      break;
+    }
+#endif
+    RotateScalar(quat, body, world, done);
+  }
+
+  void ComputeNorms(ConstVec3Columns vectors, std::span<double> norms)
+  {
+    CheckSizes(norms.size(),
+               {vectors.x.size(), vectors.y.size(), vectors.z.size()});
+    std::size_t done = 0;
+#if GCS_MATH_X86
+    switch (GetSimdLevel())
+    {
+    case SimdLevel::kAvx2:
+      done = NormsAvx2(vectors, norms);
+      break;
+    case SimdLevel::kSse4:
+      done = NormsSse4(vectors, norms);
+      break;
+    case SimdLevel::kScalar:
+      break;
+    }
+#endif
+    NormsScalar(vectors, norms, done);
+  }
+
+  void Lerp(std::span<const double> from, std::span<const double> to,
+            std::span<const double> t, std::span<double> out)
+  {
+    CheckSizes(out.size(), {from.size(), to.size(), t.size()});
+    std::size_t done = 0;
+#if GCS_MATH_X86
+    switch (GetSimdLevel())
+    {
+    case SimdLevel::kAvx2:
+      done = LerpAvx2(from, to, t, out);
+      break;
+    case SimdLevel::kSse4:
+      done = LerpSse4(from, to, t, out);
+      break;
+    case SimdLevel::kScalar:
+      break;
+    }
+#endif
+    LerpScalar(from, to, t, out, done);
+  }
+
+  void Slerp(ConstQuatColumns from, ConstQuatColumns to,
+             std::span<const double> t, QuatColumns out)
+  {
+    CheckSizes(out.w.size(), {out.x.size(), out.y.size(), out.z.size(),
+                              from.w.size(), from.x.size(), from.y.size(),
+                              from.z.size(), to.w.size(), to.x.size(),
+                              to.y.size(), to.z.size(), t.size()});
+    std::size_t done = 0;
+#if GCS_MATH_X86
+    switch (GetSimdLevel())
+    {
+    case SimdLevel::kAvx2:
+      done = SlerpAvx2(from, to, t, out);
+      break;
+    case SimdLevel::kSse4:
+      done = SlerpSse4(from, to, t, out);
+      break;
+    case SimdLevel::kScalar:
+      break;
+    }
+#endif
+    SlerpScalar(from, to, t, out, done);
+  }
+
+  void NormalizeQuaternions(std::span<TelemetryData> frames)
+  {
+    FrameBlock block;
+    for (std::size_t first = 0; first < frames.size(); first += kFrameBlock)
+    {
+      auto run = frames.subspan(first, std::min(kFrameBlock, frames.size() - first));
+      block.LoadQuat(run);
+      NormalizeQuaternions(block.Quat(run.size()));
+      for (std::size_t i = 0; i < run.size(); ++i)
+      {
+        run[i].quat.data = {block.w[i], block.x[i], block.y[i], block.z[i]};
+      }
+    }
+  }
+
+  void UpdateEulerFromQuaternions(std::span<TelemetryData> frames)
+  {
+    FrameBlock block;
+    for (std::size_t first = 0; first < frames.size(); first += kFrameBlock)
+    {
+      auto run = frames.subspan(first, std::min(kFrameBlock, frames.size() - first));
+      block.LoadQuat(run);
+      QuaternionsToEuler(block.Quat(run.size()), block.Vec(run.size()));
+      for (std::size_t i = 0; i < run.size(); ++i)
+      {
+        run[i].euler.data = {block.vx[i], block.vy[i], block.vz[i]};
+      }
+    }
+  }
+
+  void RotateAccelerationToWorld(std::span<const TelemetryData> frames,
+                                 std::span<Vec3> world)
+  {
+    CheckSizes(frames.size(), {world.size()});
+    FrameBlock block;
+    for (std::size_t first = 0; first < frames.size(); first += kFrameBlock)
+    {
+      auto run = frames.subspan(first, std::min(kFrameBlock, frames.size() - first));
+      block.LoadQuat(run);
+      for (std::size_t i = 0; i < run.size(); ++i)
+      {
+        block.vx[i] = run[i].acc.data[0];
+        block.vy[i] = run[i].acc.data[1];
+        block.vz[i] = run[i].acc.data[2];
+      }
+      Vec3Columns vec = block.Vec(run.size());
+      RotateToWorld(block.Quat(run.size()), vec, vec);
+      for (std::size_t i = 0; i < run.size(); ++i)
+      {
+        world[first + i].data = {block.vx[i], block.vy[i], block.vz[i]};
+      }
+    }
+  }
+
+  void ComputeNorms(std::span<const Vec3> vectors, std::span<double> norms)
+  {
+    CheckSizes(vectors.size(), {norms.size()});
+    FrameBlock block;
+    for (std::size_t first = 0; first < vectors.size(); first += kFrameBlock)
+    {
+      std::size_t count = std::min(kFrameBlock, vectors.size() - first);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        block.vx[i] = vectors[first + i].data[0];
+        block.vy[i] = vectors[first + i].data[1];
+        block.vz[i] = vectors[first + i].data[2];
+      }
+      ComputeNorms(block.Vec(count), norms.subspan(first, count));
+    }
+  }
+
+  namespace scalar
+  {
+    void NormalizeQuaternions(QuatColumns quat)
+    {
+      CheckSizes(quat.w.size(), {quat.x.size(), quat.y.size(), quat.z.size()});
+      NormalizeScalar(quat, 0);
+    }
+
+    void QuaternionsToEuler(ConstQuatColumns quat, Vec3Columns euler)
+    {
+      CheckSizes(quat.w.size(), {quat.x.size(), quat.y.size(), quat.z.size(),
+                                 euler.x.size(), euler.y.size(), euler.z.size()});
+      EulerScalar(quat, euler, 0);
+    }
+
+    void RotateToWorld(ConstQuatColumns quat, ConstVec3Columns body,
+                       Vec3Columns world)
+    {
+      CheckSizes(quat.w.size(), {quat.x.size(), quat.y.size(), quat.z.size(),
+                                 body.x.size(), body.y.size(), body.z.size(),
+                                 world.x.size(), world.y.size(), world.z.size()});
+      RotateScalar(quat, body, world, 0);
+    }
+
+    void ComputeNorms(ConstVec3Columns vectors, std::span<double> norms)
+    {
+      CheckSizes(norms.size(),
+                 {vectors.x.size(), vectors.y.size(), vectors.z.size()});
+      NormsScalar(vectors, norms, 0);
+    }
+
+    void Lerp(std::span<const double> from, std::span<const double> to,
+              std::span<const double> t, std::span<double> out)
+    {
+      CheckSizes(out.size(), {from.size(), to.size(), t.size()});
+      LerpScalar(from, to, t, out, 0);
+    }
+
+    void Slerp(ConstQuatColumns from, ConstQuatColumns to,
+               std::span<const double> t, QuatColumns out)
+    {
+      CheckSizes(out.w.size(), {out.x.size(), out.y.size(), out.z.size(),
+                                from.w.size(), from.x.size(), from.y.size(),
+                                from.z.size(), to.w.size(), to.x.size(),
+                                to.y.size(), to.z.size(), t.size()});
+      SlerpScalar(from, to, t, out, 0);
+    }
+  } // namespace scalar
+
+} // namespace gcs::data
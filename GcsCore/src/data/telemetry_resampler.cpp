@@ -0,0 +1,197 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "data/telemetry_resampler.h"
+
+#include <algorithm>
+#include <array>
+
+#include "data/telemetry_math.h"
+
+namespace gcs::data
+{
+
+  namespace
+  {
+    // Ticks gathered into columns per pass of the interpolation kernels.
+    constexpr std::size_t kTickBlock = 256;
+
+    // The linearly interpolated fields.
+    constexpr Vec3 TelemetryData::*kLinearFields[] = {
+        &TelemetryData::pos, &TelemetryData::vel, &TelemetryData::acc,
+        &TelemetryData::euler};
+
+    /**
+     * @brief Scratch columns for a block of ticks. Results are written over
+     * the from columns.
+     */
+    struct TickBlock
+    {
+      std::array<double, kTickBlock> t;
+      std::array<double, kTickBlock> aw, ax, ay, az;
+      std::array<double, kTickBlock> bw, bx, by, bz;
+
+      std::span<const double> T(std::size_t count) const
+      {
+        return {t.data(), count};
+      }
+
+      QuatColumns From(std::size_t count)
+      {
+        return {{aw.data(), count}, {ax.data(), count}, {ay.data(), count},
+                {az.data(), count}};
+      }
+
+      ConstQuatColumns To(std::size_t count) const
+      {
+        return {{bw.data(), count}, {bx.data(), count}, {by.data(), count},
+                {bz.data(), count}};
+      }
+    };
+  } // namespace
+
+  TelemetryResampler::TelemetryResampler(std::chrono::microseconds period,
+                                         std::chrono::microseconds max_gap)
+      : period_us_(static_cast<std::uint64_t>(
+            std::max<std::chrono::microseconds::rep>(period.count(), 1))),
+        max_gap_us_(static_cast<std::uint64_t>(
+            std::max<std::chrono::microseconds::rep>(max_gap.count(), 0)))
+  {
+  }
+
+  void TelemetryResampler::Process(std::span<const TelemetryData> frames,
+                                   std::vector<TelemetryData> &out)
+  {
+    ticks_.clear();
+    const TelemetryData *last = has_last_ ? &last_ : nullptr;
+    for (const TelemetryData &frame : frames)
+    {
+      const std::uint64_t timestamp = frame.timestamp_us;
+      if (last == nullptr || timestamp < last->timestamp_us ||
+          timestamp - last->timestamp_us > max_gap_us_)
+      {
+        // Restart the clock at the first tick at or after this frame.
+        next_tick_us_ = (timestamp + period_us_ - 1) / period_us_ * period_us_;
+        if (next_tick_us_ == timestamp)
+        {
+          ticks_.push_back({&frame, &frame, timestamp, 1.0});
+          next_tick_us_ += period_us_;
+        }
+      }
+      else
+      {
+        // next_tick_us_ is always past the last frame, so frames with a
+        // repeated timestamp only replace it.
+        const auto span = static_cast<double>(timestamp - last->timestamp_us);
+        for (; next_tick_us_ <= timestamp; next_tick_us_ += period_us_)
+        {
+          double t = static_cast<double>(next_tick_us_ - last->timestamp_us) /
+                     span;
+          ticks_.push_back({last, &frame, next_tick_us_, t});
+        }
+      }
+      last = &frame;
+    }
+
+    // Ticks may still point at last_, so interpolate before replacing it.
+    const std::size_t first = out.size();
+    out.resize(first + ticks_.size());
+    Interpolate(out, first);
+    if (last != nullptr && last != &last_)
+    {
+      last_ = *last;
+      has_last_ = true;
+    }
+  }
+
+  void TelemetryResampler::Push(std::span<const TelemetryData> frames)
+  {
+    output_.clear();
+    Process(frames, output_);
+    if (!output_.empty())
+    {
+      OnResampled.InvokeBatch(output_);
+    }
+  }
+
+  void TelemetryResampler::Reset()
+  {
+    has_last_ = false;
+    last_ = TelemetryData();
+    next_tick_us_ = 0;
+  }
+
+  void TelemetryResampler::Interpolate(std::vector<TelemetryData> &out,
+                                       std::size_t first)
+  {
+    TickBlock block;
+    for (std::size_t begin = 0; begin < ticks_.size(); begin += kTickBlock)
+    {
+      const std::size_t count = std::min(kTickBlock, ticks_.size() - begin);
+      const Tick *ticks = ticks_.data() + begin;
+      TelemetryData *frames = out.data() + first + begin;
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        const Tick &tick = ticks[i];
+        // Discrete fields hold the last value received at or before the tick.
+        const TelemetryData &held =
+            tick.timestamp_us == tick.to->timestamp_us ? *tick.to : *tick.from;
+        frames[i].timestamp_us = tick.timestamp_us;
+        frames[i].rx_count = held.rx_count;
+        frames[i].tx_count = held.tx_count;
+        frames[i].fsm = held.fsm;
+        frames[i].sensor = held.sensor;
+        frames[i].ejection = held.ejection;
+        block.t[i] = tick.t;
+      }
+
+      for (Vec3 TelemetryData::*field : kLinearFields)
+      {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          const auto &from = (ticks[i].from->*field).data;
+          const auto &to = (ticks[i].to->*field).data;
+          block.ax[i] = from[0];
+          block.ay[i] = from[1];
+          block.az[i] = from[2];
+          block.bx[i] = to[0];
+          block.by[i] = to[1];
+          block.bz[i] = to[2];
+        }
+        QuatColumns a = block.From(count);
+        ConstQuatColumns b = block.To(count);
+        Lerp(a.x, b.x, block.T(count), a.x);
+        Lerp(a.y, b.y, block.T(count), a.y);
+        Lerp(a.z, b.z, block.T(count), a.z);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          (frames[i].*field).data = {block.ax[i], block.ay[i], block.az[i]};
+        }
+      }
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        const auto &from = ticks[i].from->quat.data;
+        const auto &to = ticks[i].to->quat.data;
+        block.aw[i] = from[0];
+        block.ax[i] = from[1];
+        block.ay[i] = from[2];
+        block.az[i] = from[3];
+        block.bw[i] = to[0];
+        block.bx[i] = to[1];
+        block.by[i] = to[2];
+        block.bz[i] = to[3];
+      }
+      QuatColumns a = block.From(count);
+      Slerp(a, block.To(count), block.T(count), a);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        frames[i].quat.data = {block.aw[i], block.ax[i], block.ay[i],
+                               block.az[i]};
+      }
+    }
+  }
+
+} // namespace gcs::data
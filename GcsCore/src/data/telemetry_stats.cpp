@@ -0,0 +1,387 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "data/telemetry_stats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace gcs::data
+{
+
+  namespace
+  {
+    constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+
+    // Buffered values per centroid budget before a compression.
+    constexpr double kBufferFactor = 5.0;
+
+    // t-digest scale function k1 and its inverse: centroids may span one
+    // unit of k, which keeps them small near q = 0 and q = 1.
+    double ScaleK(double q, double compression)
+    {
+      return compression / (2.0 * std::numbers::pi) * std::asin(2.0 * q - 1.0);
+    }
+
+    double ScaleQ(double k, double compression)
+    {
+      return (std::sin(k * 2.0 * std::numbers::pi / compression) + 1.0) / 2.0;
+    }
+  } // namespace
+
+  // --- TDigest ---
+
+  TDigest::TDigest(double compression)
+      : compression_(std::max(compression, 10.0)),
+        buffer_limit_(static_cast<std::size_t>(kBufferFactor * compression_)),
+        min_(kNaN),
+        max_(kNaN)
+  {
+  }
+
+  void TDigest::Add(double value)
+  {
+    if (std::isnan(value))
+      return;
+
+    if (count_ == 0)
+    {
+      min_ = value;
+      max_ = value;
+    }
+    else
+    {
+      min_ = std::min(min_, value);
+      max_ = std::max(max_, value);
+    }
+    ++count_;
+
+    buffer_.push_back({value, 1.0});
+    if (buffer_.size() >= buffer_limit_)
+      Compress();
+  }
+
+  void TDigest::Merge(const TDigest &other)
+  {
+    if (other.count_ == 0)
+      return;
+
+    if (count_ == 0)
+    {
+      min_ = other.min_;
+      max_ = other.max_;
+    }
+    else
+    {
+      min_ = std::min(min_, other.min_);
+      max_ = std::max(max_, other.max_);
+    }
+    count_ += other.count_;
+
+    buffer_.insert(buffer_.end(), other.centroids_.begin(),
+                   other.centroids_.end());
+    buffer_.insert(buffer_.end(), other.buffer_.begin(), other.buffer_.end());
+    Compress();
+  }
+
+  void TDigest::Reset()
+  {
+    count_ = 0;
+    min_ = kNaN;
+    max_ = kNaN;
+    centroids_.clear();
+    buffer_.clear();
+  }
+
+  void TDigest::Compress() const
+  {
+    if (buffer_.empty())
+      return;
+
+    buffer_.insert(buffer_.end(), centroids_.begin(), centroids_.end());
+    std::sort(buffer_.begin(), buffer_.end(),
+              [](const Centroid &a, const Centroid &b)
+              { return a.mean < b.mean; });
+
+    double total = 0.0;
+    for (const Centroid &centroid : buffer_)
+    {
+      total += centroid.weight;
+    }
+
+    // Merge neighbours while the merged centroid stays within one unit of
+    // the scale function.
+    centroids_.clear();
+    Centroid current = buffer_.front();
+    double weight_before = 0.0;
+    double limit = total * ScaleQ(ScaleK(0.0, compression_) + 1.0,
+                                  compression_);
+    for (std::size_t i = 1; i < buffer_.size(); ++i)
+    {
+      const Centroid &next = buffer_[i];
+      if (weight_before + current.weight + next.weight <= limit)
+      {
+        current.weight += next.weight;
+        current.mean += (next.mean - current.mean) * next.weight /
+                        current.weight;
+        continue;
+      }
+      centroids_.push_back(current);
+      weight_before += current.weight;
+      limit = total * ScaleQ(ScaleK(weight_before / total, compression_) + 1.0,
+                             compression_);
+      current = next;
+    }
+    centroids_.push_back(current);
+    buffer_.clear();
+  }
+
+  double TDigest::Quantile(double q) const
+  {
+    if (count_ == 0)
+      return kNaN;
+    if (q <= 0.0)
+      return min_;
+    if (q >= 1.0)
+      return max_;
+
+    Compress();
+    // Each centroid's mass is centered on its mean; interpolate between
+    // neighbouring means, and towards the exact extremes at both ends.
+    const double index = q * static_cast<double>(count_);
+    const Centroid &first = centroids_.front();
+    if (index < first.weight / 2.0)
+    {
+      return min_ + (first.mean - min_) * index / (first.weight / 2.0);
+    }
+
+    double weight_so_far = first.weight / 2.0;
+    for (std::size_t i = 0; i + 1 < centroids_.size(); ++i)
+    {
+      const Centroid &a = centroids_[i];
+      const Centroid &b = centroids_[i + 1];
+      double step = (a.weight + b.weight) / 2.0;
+      if (weight_so_far + step > index)
+      {
+        return a.mean + (b.mean - a.mean) * (index - weight_so_far) / step;
+      }
+      weight_so_far += step;
+    }
+
+    const Centroid &last = centroids_.back();
+    double rest = static_cast<double>(count_) - weight_so_far;
+    if (rest <= 0.0)
+      return max_;
+    return last.mean + (max_ - last.mean) * (index - weight_so_far) / rest;
+  }
+
+  double TDigest::Cdf(double x) const
+  {
+    if (count_ == 0)
+      return kNaN;
+    if (x < min_)
+      return 0.0;
+    if (x >= max_)
+      return 1.0;
+
+    Compress();
+    const double total = static_cast<double>(count_);
+    const Centroid &first = centroids_.front();
+    if (x < first.mean)
+    {
+      return (first.weight / 2.0) * (x - min_) / (first.mean - min_) / total;
+    }
+
+    double weight_so_far = first.weight / 2.0;
+    for (std::size_t i = 0; i + 1 < centroids_.size(); ++i)
+    {
+      const Centroid &a = centroids_[i];
+      const Centroid &b = centroids_[i + 1];
+      double step = (a.weight + b.weight) / 2.0;
+      if (x < b.mean)
+      {
+        return (weight_so_far + step * (x - a.mean) / (b.mean - a.mean)) /
+               total;
+      }
+      weight_so_far += step;
+    }
+
+    const Centroid &last = centroids_.back();
+    return (weight_so_far +
+            (total - weight_so_far) * (x - last.mean) / (max_ - last.mean)) /
+           total;
+  }
+
+  void TDigest::Histogram(double lo, double hi, std::size_t bins,
+                          std::vector<double> &counts) const
+  {
+    counts.assign(bins, 0.0);
+    if (count_ == 0 || bins == 0 || !(hi > lo))
+      return;
+
+    const double total = static_cast<double>(count_);
+    const double width = (hi - lo) / static_cast<double>(bins);
+    double below = Cdf(lo);
+    for (std::size_t bin = 0; bin < bins; ++bin)
+    {
+      double edge = bin + 1 == bins ? hi : lo + width * (bin + 1);
+      double next = Cdf(edge);
+      counts[bin] = (next - below) * total;
+      below = next;
+    }
+  }
+
+  // --- ChannelStats ---
+
+  void ChannelStats::Add(double value, std::uint64_t timestamp)
+  {
+    if (std::isnan(value))
+      return;
+
+    if (count_ == 0 || value < min_)
+    {
+      min_ = value;
+      min_timestamp_ = timestamp;
+    }
+    if (count_ == 0 || value > max_)
+    {
+      max_ = value;
+      max_timestamp_ = timestamp;
+    }
+
+    ++count_;
+    double delta = value - mean_;
+    mean_ += delta / static_cast<double>(count_);
+    m2_ += delta * (value - mean_);
+    digest_.Add(value);
+  }
+
+  void ChannelStats::Merge(const ChannelStats &other)
+  {
+    if (other.count_ == 0)
+      return;
+
+    if (count_ == 0 || other.min_ < min_ ||
+        (other.min_ == min_ && other.min_timestamp_ < min_timestamp_))
+    {
+      min_ = other.min_;
+      min_timestamp_ = other.min_timestamp_;
+    }
+    if (count_ == 0 || other.max_ > max_ ||
+        (other.max_ == max_ && other.max_timestamp_ < max_timestamp_))
+    {
+      max_ = other.max_;
+      max_timestamp_ = other.max_timestamp_;
+    }
+
+    // Chan et al.'s pairwise combination of Welford aggregates.
+    auto a = static_cast<double>(count_);
+    auto b = static_cast<double>(other.count_);
+    double delta = other.mean_ - mean_;
+    count_ += other.count_;
+    mean_ += delta * b / (a + b);
+    m2_ += other.m2_ + delta * delta * a * b / (a + b);
+    digest_.Merge(other.digest_);
+  }
+
+  void ChannelStats::Reset()
+  {
+    *this = ChannelStats();
+  }
+
+  double ChannelStats::GetMean() const
+  {
+    return count_ == 0 ? kNaN : mean_;
+  }
+
+  double ChannelStats::GetVariance() const
+  {
+    return count_ < 2 ? kNaN : m2_ / static_cast<double>(count_ - 1);
+  }
+
+  double ChannelStats::GetStdDev() const
+  {
+    return std::sqrt(GetVariance());
+  }
+
+  // --- TelemetryStats ---
+
+  void TelemetryStats::Add(const TelemetryData &frame)
+  {
+    const std::uint64_t timestamp = frame.timestamp_us;
+    if (frame_count_ == 0)
+    {
+      first_timestamp_ = timestamp;
+      last_timestamp_ = timestamp;
+    }
+    else
+    {
+      first_timestamp_ = std::min(first_timestamp_, timestamp);
+      last_timestamp_ = std::max(last_timestamp_, timestamp);
+    }
+    ++frame_count_;
+
+    for (std::size_t c = 0; c < kTelemetryChannelCount; ++c)
+    {
+      channels_[c].Add(GetChannelValue(frame, static_cast<TelemetryChannel>(c)),
+                       timestamp);
+    }
+
+    const auto &acc = frame.acc.data;
+    const auto &vel = frame.vel.data;
+    acc_norm_.Add(std::sqrt(acc[0] * acc[0] + acc[1] * acc[1] +
+                            acc[2] * acc[2]),
+                  timestamp);
+    speed_.Add(std::sqrt(vel[0] * vel[0] + vel[1] * vel[1] + vel[2] * vel[2]),
+               timestamp);
+  }
+
+  void TelemetryStats::Add(std::span<const TelemetryData> frames)
+  {
+    for (const TelemetryData &frame : frames)
+    {
+      Add(frame);
+    }
+  }
+
+  void TelemetryStats::Merge(const TelemetryStats &other)
+  {
+    if (other.frame_count_ == 0)
+      return;
+
+    if (frame_count_ == 0)
+    {
+      first_timestamp_ = other.first_timestamp_;
+      last_timestamp_ = other.last_timestamp_;
+    }
+    else
+    {
+      first_timestamp_ = std::min(first_timestamp_, other.first_timestamp_);
+      last_timestamp_ = std::max(last_timestamp_, other.last_timestamp_);
+    }
+    frame_count_ += other.frame_count_;
+
+    for (std::size_t c = 0; c < kTelemetryChannelCount; ++c)
+    {
+      channels_[c].Merge(other.channels_[c]);
+    }
+    acc_norm_.Merge(other.acc_norm_);
+    speed_.Merge(other.speed_);
+  }
+
+  void TelemetryStats::Reset()
+  {
+    frame_count_ = 0;
+    first_timestamp_ = 0;
+    last_timestamp_ = 0;
+    for (ChannelStats &channel : channels_)
+    {
+      channel.Reset();
+    }
+    acc_norm_.Reset();
+    speed_.Reset();
+  }
+
+} // namespace gcs::data
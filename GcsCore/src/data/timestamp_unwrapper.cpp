@@ -0,0 +1,51 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "data/timestamp_unwrapper.h"
+
+#include <algorithm>
+
+namespace gcs::data
+{
+
+  TimestampUnwrapper::TimestampUnwrapper(unsigned bits)
+      : mask_((std::uint64_t{1} << std::clamp(bits, 1u, 63u)) - 1)
+  {
+  }
+
+  std::uint64_t TimestampUnwrapper::Unwrap(std::uint64_t raw)
+  {
+    raw &= mask_;
+    if (!has_last_)
+    {
+      has_last_ = true;
+      last_raw_ = raw;
+      extended_ = raw;
+      return extended_;
+    }
+
+    // Forward distance modulo the counter range; the upper half of the
+    // range means the counter stepped back.
+    std::uint64_t forward = (raw - last_raw_) & mask_;
+    if (forward <= mask_ / 2)
+    {
+      extended_ += forward;
+    }
+    else
+    {
+      std::uint64_t backward = mask_ + 1 - forward;
+      extended_ = extended_ > backward ? extended_ - backward : 0;
+    }
+    last_raw_ = raw;
+    return extended_;
+  }
+
+  void TimestampUnwrapper::Reset()
+  {
+    last_raw_ = 0;
+    extended_ = 0;
+    has_last_ = false;
+  }
+
+} // namespace gcs::data
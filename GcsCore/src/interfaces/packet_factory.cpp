@@ -0,0 +1,18 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "interfaces/packet_factory.h"
+
+#include "logging_internal.h"
+
+namespace gcs::interfaces
+{
+
+  void PacketFactory::ReportDuplicate(int id)
+  {
+    GCS_LOG_ERROR("Duplicate packet ID {}; keeping the first registration.",
+                  id);
+  }
+
+} // namespace gcs::interfaces
@@ -7,8 +7,10 @@
 #include <chrono>
 #include <filesystem>
 #include <iomanip>
+#include <span>
 #include <sstream>
 
+#include "common/config.h"
 #include "data/telemetry.h"
 #include "interfaces/i_converter.h"
 #include "interfaces/i_packet.h"
@@ -22,8 +24,10 @@ namespace gcs::logging
   BinaryLogWriter::BinaryLogWriter(
       std::unique_ptr<gcs::interfaces::IParser> parser,
       std::unique_ptr<gcs::interfaces::IConverter> converter,
-      const std::string &log_dir)
+      const std::string &log_dir,
+      ParsedLogEncoding encoding)
       : log_dir_(log_dir),
+        parsed_schema_(encoding),
         parser_(std::move(parser)),
         converter_(std::move(converter))
   {
@@ -47,24 +51,51 @@ namespace gcs::logging
     }
 
     on_packet_ = parser_->OnPacketReceived.Connect(
-        [this](std::shared_ptr<gcs::interfaces::IPacket> packet)
+        [this](const std::shared_ptr<gcs::interfaces::IPacket> &packet)
         {
           std::lock_guard<std::recursive_mutex> lock(mutex_);
           if (converter_)
             converter_->Convert(packet);
-        });
+        },
+        {"BinaryLogWriter.Packet"});
 
-    on_parsed_ = converter_->OnTelemetryConverted.Connect(
-        [this](const gcs::data::TelemetryData &data)
+    on_parsed_ = converter_->OnTelemetryConverted.ConnectBatch(
+        [this](std::span<const gcs::data::TelemetryData> frames)
         {
           std::lock_guard<std::recursive_mutex> lock(mutex_);
           if (parsed_file_.is_open())
           {
-            parsed_file_.write(reinterpret_cast<const char *>(&data),
-                               sizeof(gcs::data::TelemetryData));
+            std::size_t record_size = parsed_schema_.GetRecordSize();
+            parsed_records_.resize(frames.size() * record_size);
+            for (std::size_t i = 0; i < frames.size(); ++i)
+            {
+              parsed_schema_.Encode(
+                  frames[i], std::span<std::uint8_t>(parsed_records_)
+                                 .subspan(i * record_size, record_size));
+            }
+            parsed_file_.write(
+                reinterpret_cast<const char *>(parsed_records_.data()),
+                parsed_records_.size());
+
+            if (pyramid_file_.is_open())
+            {
+              pyramid_.Append(frames);
+              std::span<const std::uint8_t> nodes = pyramid_.GetOutput();
+              if (!nodes.empty())
+              {
+                pyramid_file_.write(reinterpret_cast<const char *>(nodes.data()),
+                                    nodes.size());
+                pyramid_.ClearOutput();
+                // Flush both files whenever a leaf completes, log first, so
+                // the sidecar on disk never covers frames the log lacks.
+                parsed_file_.flush();
+                pyramid_file_.flush();
+              }
+            }
             // GCS_LOG_TRACE("Wrote parsed telemetry data to file.");
           }
-        });
+        },
+        {"BinaryLogWriter.Parsed"});
   }
 
   BinaryLogWriter::~BinaryLogWriter()
@@ -77,35 +108,50 @@ namespace gcs::logging
     StopLogging();
   }
 
-  void BinaryLogWriter::Bind(gcs::transport::SerialManager &serial)
+  void BinaryLogWriter::Bind(gcs::transport::SerialManager &serial,
+                             gcs::common::QueueOptions raw_queue)
   {
     on_opened_connection_ = serial.OnPortOpened.Connect(
         [this](const gcs::transport::SerialPortInfo &info)
         {
           GCS_LOG_INFO("Port opened: {}. Starting loggers.", info.name);
           StartLogging();
-        });
+        },
+        {"BinaryLogWriter.PortOpened", gcs::common::kLoggerListenerPriority});
 
     on_closed_connection_ = serial.OnPortClosed.Connect(
         [this](const gcs::transport::SerialPortInfo &info)
         {
           GCS_LOG_INFO("Port closed: {}. Stopping loggers.", info.name);
           StopLogging();
-        });
+        },
+        {"BinaryLogWriter.PortClosed", gcs::common::kLoggerListenerPriority});
 
-    on_raw_ = serial.OnRawDataReceived.Connect(
-        [this](const std::vector<std::uint8_t> &data)
-        {
-          std::lock_guard<std::recursive_mutex> lock(mutex_);
-          if (raw_file_.is_open())
-          {
-            raw_file_.write(reinterpret_cast<const char *>(data.data()),
-                            data.size());
-            GCS_LOG_TRACE("Wrote {} raw bytes to log file.", data.size());
-          }
-          if (parser_)
-            parser_->PushData(data);
-        });
+    auto on_raw = [this](const std::vector<std::uint8_t> &data)
+    {
+      std::lock_guard<std::recursive_mutex> lock(mutex_);
+      if (raw_file_.is_open())
+      {
+        raw_file_.write(reinterpret_cast<const char *>(data.data()),
+                        data.size());
+        GCS_LOG_TRACE("Wrote {} raw bytes to log file.", data.size());
+      }
+      if (parser_)
+        parser_->PushData(data);
+    };
+
+    gcs::common::ListenerOptions raw_options{
+        "BinaryLogWriter.Raw", gcs::common::kLoggerListenerPriority};
+    if (raw_queue.executor)
+    {
+      on_raw_ = serial.OnRawDataReceived.ConnectQueued(
+          std::move(on_raw), std::move(raw_queue), std::move(raw_options));
+    }
+    else
+    {
+      on_raw_ = serial.OnRawDataReceived.Connect(std::move(on_raw),
+                                                 std::move(raw_options));
+    }
   }
 
   void BinaryLogWriter::StartLogging()
@@ -116,6 +162,8 @@ namespace gcs::logging
       raw_file_.close();
     if (parsed_file_.is_open())
       parsed_file_.close();
+    if (pyramid_file_.is_open())
+      pyramid_file_.close();
 
     std::string ts = GetTimestamp();
     std::string raw_path = log_dir_ + "/" + ts + "_raw.bin";
@@ -134,7 +182,24 @@ namespace gcs::logging
     parsed_file_.open(parsed_path, std::ios::binary);
     if (parsed_file_.is_open())
     {
+      std::vector<std::uint8_t> header = parsed_schema_.WriteHeader();
+      parsed_file_.write(reinterpret_cast<const char *>(header.data()),
+                         header.size());
       GCS_LOG_INFO("Started parsed logging: {}", parsed_path);
+
+      std::string pyramid_path = GetLogPyramidPath(parsed_path);
+      pyramid_.Reset();
+      pyramid_file_.open(pyramid_path, std::ios::binary);
+      if (pyramid_file_.is_open())
+      {
+        header = pyramid_.WriteHeader();
+        pyramid_file_.write(reinterpret_cast<const char *>(header.data()),
+                            header.size());
+      }
+      else
+      {
+        GCS_LOG_WARN("Failed to open log pyramid: {}", pyramid_path);
+      }
     }
     else
     {
@@ -151,6 +216,9 @@ namespace gcs::logging
       raw_file_.close();
     if (parsed_file_.is_open())
       parsed_file_.close();
+    // Frames after the last complete leaf are read from the log itself.
+    if (pyramid_file_.is_open())
+      pyramid_file_.close();
 
     if (was_open)
     {
@@ -8,6 +8,7 @@
 #include <filesystem>
 #include <vector>
 
+#include "common/config.h"
 #include "data/telemetry.h"
 #include "interfaces/i_converter.h"
 #include "interfaces/i_packet.h"
@@ -23,32 +24,36 @@ namespace gcs::logging
 
   LogPlayer::LogPlayer(std::unique_ptr<gcs::interfaces::IParser> parser,
                        std::unique_ptr<gcs::interfaces::IConverter> converter)
-      : parser_(std::move(parser)), converter_(std::move(converter))
+      : parser_(std::move(parser)), converter_(std::move(converter)),
+        parsed_batch_(gcs::common::kParsedLogReplayBatchFrames),
+        raw_chunk_(kChunkSize)
   {
     if (parser_)
     {
       on_packet_ = parser_->OnPacketReceived.Connect(
-          [this](std::shared_ptr<gcs::interfaces::IPacket> packet)
+          [this](const std::shared_ptr<gcs::interfaces::IPacket> &packet)
           {
             if (converter_)
               converter_->Convert(packet);
-          });
+          },
+          {"LogPlayer.Packet"});
 
       on_crc_fail_ = parser_->OnCrcFailed.Connect(
           [this](const std::vector<std::uint8_t> &data)
           {
             OnCrcFailed.Invoke(data);
-          });
+          },
+          {"LogPlayer.CrcFailed"});
     }
 
     if (converter_)
     {
-      on_converted_ = converter_->OnTelemetryConverted.Connect(
-          [this](const gcs::data::TelemetryData &data)
+      on_converted_ = converter_->OnTelemetryConverted.ConnectBatch(
+          [this](std::span<const gcs::data::TelemetryData> frames)
           {
-            SyncTiming(data.timestamp);
-            OnTelemetry.Invoke(data);
-          });
+            EmitTimed(frames);
+          },
+          {"LogPlayer.Converted"});
     }
   }
 
@@ -72,7 +77,31 @@ namespace gcs::logging
     file_.clear();
     file_.seekg(0, std::ios::beg);
 
-    last_pkt_timestamp_ = 0;
+    parsed_schema_.reset();
+    timestamp_unwrapper_.Reset();
+    data_offset_ = 0;
+    record_size_ = sizeof(LegacyTelemetryData);
+    if (type_ == LogType::kParsed && !LoadParsedHeader())
+    {
+      file_.close();
+      return false;
+    }
+
+    reanchor_ = true;
+    return true;
+  }
+
+  bool LogPlayer::LoadParsedHeader()
+  {
+    if (!ParsedLogSchema::ReadFileHeader(file_, parsed_schema_))
+      return false;
+
+    if (parsed_schema_)
+    {
+      data_offset_ = parsed_schema_->GetHeaderSize();
+      record_size_ = parsed_schema_->GetRecordSize();
+    }
+    parsed_bytes_.resize(parsed_batch_.size() * record_size_);
     return true;
   }
 
@@ -109,9 +138,10 @@ namespace gcs::logging
     if (file_.is_open())
     {
       file_.clear();
-      file_.seekg(0, std::ios::beg);
+      file_.seekg(data_offset_, std::ios::beg);
     }
-    last_pkt_timestamp_ = 0;
+    timestamp_unwrapper_.Reset();
+    reanchor_ = true;
   }
 
   void LogPlayer::SetSpeed(double speed)
@@ -119,6 +149,7 @@ namespace gcs::logging
     if (speed > 0.0)
     {
       speed_ = speed;
+      reanchor_ = true;
     }
   }
 
@@ -137,14 +168,15 @@ namespace gcs::logging
 
     if (type_ == LogType::kParsed)
     {
-      size_t struct_size = sizeof(gcs::data::TelemetryData);
-      offset = (offset / struct_size) * struct_size;
+      size_t body_offset = offset > data_offset_ ? offset - data_offset_ : 0;
+      offset = data_offset_ + (body_offset / record_size_) * record_size_;
     }
 
     file_.clear();
     file_.seekg(offset, std::ios::beg);
+    timestamp_unwrapper_.Reset();
 
-    last_pkt_timestamp_ = 0;
+    reanchor_ = true;
 
     if (parser_)
       parser_->Reset();
@@ -164,6 +196,7 @@ namespace gcs::logging
     {
       if (is_paused_)
       {
+        reanchor_ = true;
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
         continue;
       }
@@ -190,18 +223,30 @@ namespace gcs::logging
 
   bool LogPlayer::HandleParsedFrame()
   {
-    gcs::data::TelemetryData data;
+    size_t frames_read = 0;
     {
+      // Decoded under the lock so that a seek resets the unwrapper between
+      // batches, never during one.
       std::lock_guard<std::mutex> lock(file_mutex_);
       if (!file_.good())
         return false;
-      file_.read(reinterpret_cast<char *>(&data), sizeof(data));
+      file_.read(reinterpret_cast<char *>(parsed_bytes_.data()),
+                 parsed_bytes_.size());
+      size_t bytes_read = static_cast<size_t>(file_.gcount());
+
+      // Legacy files hold LegacyTelemetryData structs as laid out in memory.
+      std::span<const std::uint8_t> bytes(parsed_bytes_.data(), bytes_read);
+      frames_read = parsed_schema_
+                        ? parsed_schema_->DecodeRecords(bytes, parsed_batch_,
+                                                        timestamp_unwrapper_)
+                        : DecodeLegacyRecords(bytes, parsed_batch_,
+                                              timestamp_unwrapper_);
     }
 
-    if (file_.gcount() == sizeof(data))
+    if (frames_read > 0)
     {
-      SyncTiming(data.timestamp);
-      OnTelemetry.Invoke(data);
+      EmitTimed(std::span<const gcs::data::TelemetryData>(parsed_batch_.data(),
+                                                          frames_read));
       return true;
     }
     return false;
@@ -212,44 +257,80 @@ namespace gcs::logging
     if (!parser_)
       return false;
 
-    std::vector<std::uint8_t> buffer(kChunkSize);
     size_t bytes_read = 0;
     {
       std::lock_guard<std::mutex> lock(file_mutex_);
       if (!file_.good())
         return false;
-      file_.read(reinterpret_cast<char *>(buffer.data()), kChunkSize);
+      file_.read(reinterpret_cast<char *>(raw_chunk_.data()),
+                 raw_chunk_.size());
       bytes_read = static_cast<size_t>(file_.gcount());
     }
 
     if (bytes_read > 0)
     {
-      buffer.resize(bytes_read);
-      parser_->PushData(buffer);
+      parser_->PushData(
+          std::span<const std::uint8_t>(raw_chunk_.data(), bytes_read));
       return true;
     }
     return false;
   }
 
-  void LogPlayer::SyncTiming(std::uint32_t current_ts)
+  void LogPlayer::EmitTimed(std::span<const gcs::data::TelemetryData> frames)
   {
-    if (last_pkt_timestamp_ == 0)
+    // Frames that are due immediately are forwarded together; the run is cut
+    // wherever the replay clock has to wait.
+    size_t run_begin = 0;
+    for (size_t i = 0; i < frames.size(); ++i)
     {
-      last_pkt_timestamp_ = current_ts;
-      return;
+      auto due = NextDueTime(frames[i].timestamp_us);
+      if (due - std::chrono::steady_clock::now() <
+          gcs::common::kReplayBusyLoopSleep)
+        continue;
+
+      OnTelemetry.InvokeBatch(frames.subspan(run_begin, i - run_begin));
+      run_begin = i;
+
+      // Sleeping until an absolute time keeps oversleeps from adding up.
+      std::this_thread::sleep_until(due);
+      if (!WaitWhilePaused())
+        return;
     }
+    OnTelemetry.InvokeBatch(frames.subspan(run_begin));
+  }
 
-    long long delta_ms = static_cast<long long>(current_ts) - last_pkt_timestamp_;
-    if (delta_ms > 0 && delta_ms < 5000)
+  std::chrono::steady_clock::time_point LogPlayer::NextDueTime(
+      std::uint64_t timestamp_us)
+  {
+    constexpr auto kMaxGapUs =
+        std::chrono::microseconds(gcs::common::kReplayMaxGap).count();
+    auto now = std::chrono::steady_clock::now();
+    if (reanchor_.exchange(false) || timestamp_us < last_timestamp_us_ ||
+        timestamp_us - last_timestamp_us_ > kMaxGapUs)
     {
-      double wait_ms = delta_ms / speed_;
-      if (wait_ms > 1.0)
-      {
-        std::this_thread::sleep_for(
-            std::chrono::milliseconds(static_cast<long long>(wait_ms)));
-      }
+      anchor_time_ = now;
+      anchor_timestamp_us_ = timestamp_us;
+    }
+    last_timestamp_us_ = timestamp_us;
+
+    std::chrono::duration<double, std::micro> offset(
+        static_cast<double>(timestamp_us - anchor_timestamp_us_) / speed_);
+    return anchor_time_ +
+           std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+               offset);
+  }
+
+  bool LogPlayer::WaitWhilePaused()
+  {
+    if (!is_paused_)
+      return !stop_flag_;
+
+    while (is_paused_ && !stop_flag_)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
-    last_pkt_timestamp_ = current_ts;
+    reanchor_ = true;
+    return !stop_flag_;
   }
 
 } // namespace gcs::logging
\ No newline at end of file
@@ -0,0 +1,481 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "logging/log_pyramid.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <filesystem>
+#include <limits>
+#include <optional>
+
+#include "logging/parsed_log_format.h"
+
+namespace gcs::logging
+{
+
+  namespace
+  {
+    using gcs::data::kTelemetryChannelCount;
+    using gcs::data::TelemetryData;
+
+    // Frames decoded per read while building a sidecar.
+    constexpr std::size_t kBuildBatchFrames = 4096;
+
+    // Largest supported leaf_shift; keeps node sizes within 64 bits.
+    constexpr std::uint32_t kMaxLeafShift = 24;
+
+    template <typename T>
+    void StoreLE(std::uint8_t *out, T value)
+    {
+      for (std::size_t i = 0; i < sizeof(T); ++i)
+      {
+        out[i] = static_cast<std::uint8_t>(value >> (8 * i));
+      }
+    }
+
+    template <typename T>
+    T LoadLE(const std::uint8_t *in)
+    {
+      T value = 0;
+      for (std::size_t i = 0; i < sizeof(T); ++i)
+      {
+        value |= static_cast<T>(in[i]) << (8 * i);
+      }
+      return value;
+    }
+
+    // Records written once t leaves are complete: every leaf plus every
+    // completed ancestor, i.e. sum over levels of t >> level.
+    std::uint64_t RecordsAfterLeaves(std::uint64_t t)
+    {
+      return 2 * t - std::popcount(t);
+    }
+
+    // Position of node (level, index) in the record sequence. It is written
+    // right after leaf t - 1 with t = (index + 1) << level, followed only by
+    // the ancestors above it that t completes.
+    std::uint64_t NodePosition(std::size_t level, std::size_t index)
+    {
+      std::uint64_t t = static_cast<std::uint64_t>(index + 1) << level;
+      return RecordsAfterLeaves(t) - 1 -
+             (static_cast<std::uint64_t>(std::countr_zero(t)) - level);
+    }
+
+    // Reads the number of records in a parsed log.
+    bool CountLogFrames(const std::string &log_path, std::size_t &frames)
+    {
+      std::ifstream log(log_path, std::ios::binary);
+      std::optional<ParsedLogSchema> schema;
+      if (!log.is_open() || !ParsedLogSchema::ReadFileHeader(log, schema))
+        return false;
+
+      auto data_offset = static_cast<std::size_t>(log.tellg());
+      log.seekg(0, std::ios::end);
+      auto file_size = static_cast<std::size_t>(log.tellg());
+      std::size_t record_size =
+          schema ? schema->GetRecordSize() : sizeof(LegacyTelemetryData);
+      frames = (file_size - data_offset) / record_size;
+      return true;
+    }
+  } // namespace
+
+  // --- LogPyramidBuilder ---
+
+  LogPyramidBuilder::LogPyramidBuilder(std::uint32_t leaf_shift)
+      : leaf_shift_(std::min(leaf_shift, kMaxLeafShift)), levels_(1)
+  {
+  }
+
+  std::vector<std::uint8_t> LogPyramidBuilder::WriteHeader() const
+  {
+    // magic[8] | version u16 | header_size u16 | leaf_shift u8 |
+    // channel_count u8 | reserved[2] | record_size u32 | reserved[12]
+    std::vector<std::uint8_t> header(kHeaderSize, 0);
+    std::copy(kLogPyramidMagic.begin(), kLogPyramidMagic.end(),
+              header.begin());
+    StoreLE(header.data() + 8, kLogPyramidVersion);
+    StoreLE(header.data() + 10, static_cast<std::uint16_t>(kHeaderSize));
+    header[12] = static_cast<std::uint8_t>(leaf_shift_);
+    header[13] = static_cast<std::uint8_t>(kTelemetryChannelCount);
+    StoreLE(header.data() + 16, static_cast<std::uint32_t>(kRecordSize));
+    return header;
+  }
+
+  void LogPyramidBuilder::Append(std::span<const TelemetryData> frames)
+  {
+    const std::size_t leaf_frames = std::size_t{1} << leaf_shift_;
+    for (const TelemetryData &frame : frames)
+    {
+      Accumulator &leaf = levels_[0];
+      if (leaf.size == 0)
+        leaf.first_timestamp_us = frame.timestamp_us;
+      leaf.last_timestamp_us = frame.timestamp_us;
+
+      std::size_t c = 0;
+      auto add = [&leaf, &c](std::span<const double> values)
+      {
+        for (double value : values)
+        {
+          if (!std::isnan(value))
+          {
+            if (leaf.count[c] == 0)
+            {
+              leaf.min[c] = value;
+              leaf.max[c] = value;
+            }
+            else
+            {
+              leaf.min[c] = std::min(leaf.min[c], value);
+              leaf.max[c] = std::max(leaf.max[c], value);
+            }
+            leaf.sum[c] += value;
+            ++leaf.count[c];
+          }
+          ++c;
+        }
+      };
+      add(frame.pos.data);
+      add(frame.vel.data);
+      add(frame.acc.data);
+      add(frame.quat.data);
+      add(frame.euler.data);
+
+      if (++leaf.size == leaf_frames)
+        CompleteLeaf();
+    }
+  }
+
+  void LogPyramidBuilder::Reset()
+  {
+    levels_.assign(1, Accumulator{});
+    output_.clear();
+  }
+
+  void LogPyramidBuilder::CompleteLeaf()
+  {
+    Emit(levels_[0]);
+    Accumulator node = levels_[0];
+    levels_[0] = Accumulator{};
+
+    // Fold the finished node into its parent; a parent with both children
+    // is finished in turn.
+    for (std::size_t level = 1;; ++level)
+    {
+      if (level == levels_.size())
+        levels_.emplace_back();
+      Accumulator &parent = levels_[level];
+      Merge(parent, node);
+      if (++parent.size < 2)
+        break;
+
+      Emit(parent);
+      node = parent;
+      parent = Accumulator{};
+    }
+  }
+
+  void LogPyramidBuilder::Merge(Accumulator &into,
+                                const Accumulator &node) const
+  {
+    if (into.size == 0)
+      into.first_timestamp_us = node.first_timestamp_us;
+    into.last_timestamp_us = node.last_timestamp_us;
+
+    for (std::size_t c = 0; c < kTelemetryChannelCount; ++c)
+    {
+      if (node.count[c] == 0)
+        continue;
+      if (into.count[c] == 0)
+      {
+        into.min[c] = node.min[c];
+        into.max[c] = node.max[c];
+      }
+      else
+      {
+        into.min[c] = std::min(into.min[c], node.min[c]);
+        into.max[c] = std::max(into.max[c], node.max[c]);
+      }
+      into.sum[c] += node.sum[c];
+      into.count[c] += node.count[c];
+    }
+  }
+
+  void LogPyramidBuilder::Emit(const Accumulator &node)
+  {
+    // first_timestamp_us u64 | last_timestamp_us u64 |
+    // channel_count * (min f64 | max f64 | mean f64)
+    std::size_t offset = output_.size();
+    output_.resize(offset + kRecordSize);
+    std::uint8_t *out = output_.data() + offset;
+    StoreLE(out, node.first_timestamp_us);
+    StoreLE(out + 8, node.last_timestamp_us);
+    out += 16;
+
+    constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+    for (std::size_t c = 0; c < kTelemetryChannelCount; ++c, out += 24)
+    {
+      bool any = node.count[c] != 0;
+      double mean = any ? node.sum[c] / static_cast<double>(node.count[c])
+                        : kNaN;
+      StoreLE(out, std::bit_cast<std::uint64_t>(any ? node.min[c] : kNaN));
+      StoreLE(out + 8, std::bit_cast<std::uint64_t>(any ? node.max[c] : kNaN));
+      StoreLE(out + 16, std::bit_cast<std::uint64_t>(mean));
+    }
+  }
+
+  // --- LogPyramid ---
+
+  bool LogPyramid::Open(const std::string &path)
+  {
+    Close();
+    file_.open(path, std::ios::binary);
+    if (!file_.is_open())
+      return false;
+
+    std::array<std::uint8_t, LogPyramidBuilder::kHeaderSize> header{};
+    file_.read(reinterpret_cast<char *>(header.data()), header.size());
+    bool valid =
+        file_.gcount() == static_cast<std::streamsize>(header.size()) &&
+        std::equal(kLogPyramidMagic.begin(), kLogPyramidMagic.end(),
+                   header.begin());
+    if (valid)
+    {
+      auto version = LoadLE<std::uint16_t>(header.data() + 8);
+      valid = version == kLogPyramidVersion &&
+              LoadLE<std::uint16_t>(header.data() + 10) ==
+                  LogPyramidBuilder::kHeaderSize &&
+              header[12] <= kMaxLeafShift &&
+              header[13] == kTelemetryChannelCount &&
+              LoadLE<std::uint32_t>(header.data() + 16) ==
+                  LogPyramidBuilder::kRecordSize;
+    }
+    if (!valid)
+    {
+      Close();
+      return false;
+    }
+
+    leaf_shift_ = header[12];
+    record_.resize(LogPyramidBuilder::kRecordSize);
+    Refresh();
+    return true;
+  }
+
+  void LogPyramid::Close()
+  {
+    if (file_.is_open())
+      file_.close();
+    file_.clear();
+    leaf_count_ = 0;
+  }
+
+  void LogPyramid::Refresh()
+  {
+    if (!file_.is_open())
+      return;
+
+    file_.clear();
+    file_.seekg(0, std::ios::end);
+    auto size = static_cast<std::uint64_t>(file_.tellg());
+    std::uint64_t records = (size - LogPyramidBuilder::kHeaderSize) /
+                            LogPyramidBuilder::kRecordSize;
+
+    // Largest leaf count whose records are all present.
+    std::uint64_t lo = 0;
+    std::uint64_t hi = records;
+    while (lo < hi)
+    {
+      std::uint64_t mid = hi - (hi - lo) / 2;
+      if (RecordsAfterLeaves(mid) <= records)
+        lo = mid;
+      else
+        hi = mid - 1;
+    }
+    leaf_count_ = static_cast<std::size_t>(lo);
+  }
+
+  bool LogPyramid::ReadNode(std::size_t level, std::size_t index,
+                            PyramidNode &node)
+  {
+    if (!file_.is_open() || level >= 64 - leaf_shift_ ||
+        index >= (leaf_count_ >> level))
+      return false;
+
+    file_.clear();
+    file_.seekg(static_cast<std::streamoff>(
+        LogPyramidBuilder::kHeaderSize +
+        NodePosition(level, index) * LogPyramidBuilder::kRecordSize));
+    file_.read(reinterpret_cast<char *>(record_.data()), record_.size());
+    if (file_.gcount() != static_cast<std::streamsize>(record_.size()))
+      return false;
+
+    const std::uint8_t *in = record_.data();
+    node.first_timestamp_us = LoadLE<std::uint64_t>(in);
+    node.last_timestamp_us = LoadLE<std::uint64_t>(in + 8);
+    in += 16;
+    for (PyramidChannelSummary &summary : node.channels)
+    {
+      summary.min = std::bit_cast<double>(LoadLE<std::uint64_t>(in));
+      summary.max = std::bit_cast<double>(LoadLE<std::uint64_t>(in + 8));
+      summary.mean = std::bit_cast<double>(LoadLE<std::uint64_t>(in + 16));
+      in += 24;
+    }
+    return true;
+  }
+
+  std::size_t LogPyramid::FindFrame(std::uint64_t timestamp_us)
+  {
+    PyramidNode node;
+    std::size_t lo = 0;
+    std::size_t hi = leaf_count_;
+    while (lo < hi)
+    {
+      std::size_t mid = lo + (hi - lo) / 2;
+      if (!ReadNode(0, mid, node))
+        return GetFrameCount();
+      if (node.last_timestamp_us < timestamp_us)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    return lo << leaf_shift_;
+  }
+
+  void LogPyramid::Query(gcs::data::TelemetryChannel channel,
+                         std::size_t first_frame, std::size_t last_frame,
+                         std::size_t max_buckets,
+                         std::vector<PyramidBucket> &out)
+  {
+    out.clear();
+    if (first_frame >= last_frame)
+      return;
+
+    std::size_t first_leaf = first_frame >> leaf_shift_;
+    std::size_t last_leaf = std::min(
+        (last_frame + GetLeafFrames() - 1) >> leaf_shift_, leaf_count_);
+    if (first_leaf >= last_leaf)
+      return;
+
+    // Coarsest level at which the range spans at most max_buckets nodes.
+    std::size_t leaves = last_leaf - first_leaf;
+    max_buckets = std::max<std::size_t>(max_buckets, 2);
+    std::size_t level = 0;
+    while (((leaves - 1) >> level) + 2 > max_buckets)
+      ++level;
+
+    // Walk the range with nodes of that level, dropping to finer ones where
+    // the coarse node is not complete yet or the start is not aligned.
+    std::size_t leaf = first_leaf >> level << level;
+    if (leaf + (std::size_t{1} << level) > leaf_count_)
+      leaf = first_leaf;
+
+    auto index = static_cast<std::size_t>(channel);
+    PyramidNode node;
+    while (leaf < last_leaf)
+    {
+      std::size_t node_level = level;
+      while (node_level > 0 &&
+             ((leaf & ((std::size_t{1} << node_level) - 1)) != 0 ||
+              leaf + (std::size_t{1} << node_level) > leaf_count_))
+      {
+        --node_level;
+      }
+      if (!ReadNode(node_level, leaf >> node_level, node))
+        return;
+
+      out.push_back({leaf << leaf_shift_,
+                     GetLeafFrames() << node_level, node.first_timestamp_us,
+                     node.last_timestamp_us, node.channels[index]});
+      leaf += std::size_t{1} << node_level;
+    }
+  }
+
+  // --- Sidecar files ---
+
+  std::string GetLogPyramidPath(const std::string &log_path)
+  {
+    return std::filesystem::path(log_path).replace_extension(".pyr").string();
+  }
+
+  bool BuildLogPyramid(const std::string &log_path)
+  {
+    std::ifstream log(log_path, std::ios::binary);
+    std::optional<ParsedLogSchema> schema;
+    if (!log.is_open() || !ParsedLogSchema::ReadFileHeader(log, schema))
+      return false;
+
+    // Write to a temporary file so readers never see a partial rebuild.
+    std::string path = GetLogPyramidPath(log_path);
+    std::string temp_path = path + ".tmp";
+    std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+      return false;
+
+    LogPyramidBuilder builder;
+    std::vector<std::uint8_t> header = builder.WriteHeader();
+    out.write(reinterpret_cast<const char *>(header.data()), header.size());
+
+    gcs::data::TimestampUnwrapper unwrapper;
+    std::vector<TelemetryData> frames(kBuildBatchFrames);
+    std::vector<std::uint8_t> bytes(
+        frames.size() *
+        (schema ? schema->GetRecordSize() : sizeof(LegacyTelemetryData)));
+
+    while (log)
+    {
+      log.read(reinterpret_cast<char *>(bytes.data()), bytes.size());
+      std::span<const std::uint8_t> read(
+          bytes.data(), static_cast<std::size_t>(log.gcount()));
+      std::size_t count =
+          schema ? schema->DecodeRecords(read, frames, unwrapper)
+                 : DecodeLegacyRecords(read, frames, unwrapper);
+      if (count == 0)
+        break;
+
+      builder.Append(std::span<const TelemetryData>(frames.data(), count));
+      std::span<const std::uint8_t> records = builder.GetOutput();
+      out.write(reinterpret_cast<const char *>(records.data()),
+                records.size());
+      builder.ClearOutput();
+    }
+
+    out.close();
+    std::error_code ec;
+    if (!out)
+    {
+      std::filesystem::remove(temp_path, ec);
+      return false;
+    }
+    std::filesystem::rename(temp_path, path, ec);
+    return !ec;
+  }
+
+  void BuildLogPyramidAsync(std::string log_path,
+                            gcs::common::IExecutor &executor,
+                            gcs::common::Delegate<void(bool)> on_done)
+  {
+    executor.Post(
+        [log_path = std::move(log_path), on_done = std::move(on_done)]()
+        {
+          bool current = false;
+          std::size_t frames = 0;
+          LogPyramid pyramid;
+          if (CountLogFrames(log_path, frames) &&
+              pyramid.Open(GetLogPyramidPath(log_path)))
+          {
+            // The sidecar may use another leaf size than this build.
+            current = pyramid.GetLeafCount() ==
+                      frames / pyramid.GetLeafFrames();
+          }
+          pyramid.Close();
+
+          bool ok = current || BuildLogPyramid(log_path);
+          if (on_done)
+            on_done(ok);
+        });
+  }
+
+} // namespace gcs::logging
@@ -0,0 +1,481 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "logging/parsed_log_format.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace gcs::logging
+{
+
+  namespace
+  {
+    using gcs::data::TelemetryChannel;
+    using gcs::data::TelemetryData;
+
+    // Fixed-point resolution per channel group: pos, vel, acc, quat, euler.
+    // Ranges are +-2^31 times the scale, e.g. +-214 km for positions.
+    constexpr double kPosScale = 1e-4;
+    constexpr double kVelScale = 1e-4;
+    constexpr double kAccScale = 1e-4;
+    constexpr double kQuatScale = 1e-9;
+    constexpr double kEulerScale = 1e-8;
+
+    template <typename T>
+    void StoreLE(std::uint8_t *out, T value)
+    {
+      for (std::size_t i = 0; i < sizeof(T); ++i)
+      {
+        out[i] = static_cast<std::uint8_t>(value >> (8 * i));
+      }
+    }
+
+    template <typename T>
+    T LoadLE(const std::uint8_t *in)
+    {
+      T value = 0;
+      for (std::size_t i = 0; i < sizeof(T); ++i)
+      {
+        value |= static_cast<T>(in[i]) << (8 * i);
+      }
+      return value;
+    }
+
+    std::size_t FieldSize(ParsedFieldType type)
+    {
+      switch (type)
+      {
+      case ParsedFieldType::kU8:
+        return 1;
+      case ParsedFieldType::kU32:
+      case ParsedFieldType::kF32:
+      case ParsedFieldType::kFixed32:
+        return 4;
+      case ParsedFieldType::kF64:
+      case ParsedFieldType::kU64:
+        return 8;
+      }
+      return 0;
+    }
+
+    double ChannelScale(TelemetryChannel channel)
+    {
+      auto index = static_cast<std::size_t>(channel);
+      if (index < 3)
+        return kPosScale;
+      if (index < 6)
+        return kVelScale;
+      if (index < 9)
+        return kAccScale;
+      if (index < 13)
+        return kQuatScale;
+      return kEulerScale;
+    }
+
+    void WriteField(const ParsedLogField &field, std::uint8_t *out,
+                    double value)
+    {
+      switch (field.type)
+      {
+      case ParsedFieldType::kU8:
+        *out = static_cast<std::uint8_t>(value);
+        break;
+      case ParsedFieldType::kU32:
+        StoreLE(out, static_cast<std::uint32_t>(value));
+        break;
+      case ParsedFieldType::kF32:
+        StoreLE(out, std::bit_cast<std::uint32_t>(static_cast<float>(value)));
+        break;
+      case ParsedFieldType::kF64:
+        StoreLE(out, std::bit_cast<std::uint64_t>(value));
+        break;
+      case ParsedFieldType::kU64:
+        StoreLE(out, static_cast<std::uint64_t>(value));
+        break;
+      case ParsedFieldType::kFixed32:
+      {
+        // Out-of-range values saturate; NaN is stored as 0.
+        constexpr double kMin = std::numeric_limits<std::int32_t>::min();
+        constexpr double kMax = std::numeric_limits<std::int32_t>::max();
+        double scaled = std::round(value / field.scale);
+        if (std::isnan(scaled))
+          scaled = 0.0;
+        scaled = std::clamp(scaled, kMin, kMax);
+        StoreLE(out, static_cast<std::uint32_t>(
+                         static_cast<std::int32_t>(scaled)));
+        break;
+      }
+      }
+    }
+
+    double ReadField(const ParsedLogField &field, const std::uint8_t *in)
+    {
+      switch (field.type)
+      {
+      case ParsedFieldType::kU8:
+        return *in;
+      case ParsedFieldType::kU32:
+        return LoadLE<std::uint32_t>(in);
+      case ParsedFieldType::kF32:
+        return std::bit_cast<float>(LoadLE<std::uint32_t>(in));
+      case ParsedFieldType::kF64:
+        return std::bit_cast<double>(LoadLE<std::uint64_t>(in));
+      case ParsedFieldType::kFixed32:
+        return static_cast<std::int32_t>(LoadLE<std::uint32_t>(in)) *
+               field.scale;
+      case ParsedFieldType::kU64:
+        return static_cast<double>(LoadLE<std::uint64_t>(in));
+      }
+      return 0.0;
+    }
+
+    // Integer fields keep their exact value; doubles only round above 2^53,
+    // which is 285 years of microseconds, so going through double is
+    // lossless here.
+    double GetFieldValue(const TelemetryData &frame, ParsedFieldId id)
+    {
+      switch (id)
+      {
+      case ParsedFieldId::kTimestampMs:
+        return static_cast<double>(frame.timestamp_us / 1000);
+      case ParsedFieldId::kTimestampUs:
+        return static_cast<double>(frame.timestamp_us);
+      case ParsedFieldId::kRxCount:
+        return frame.rx_count;
+      case ParsedFieldId::kTxCount:
+        return frame.tx_count;
+      case ParsedFieldId::kFsm:
+        return frame.fsm;
+      case ParsedFieldId::kSensor:
+        return frame.sensor;
+      case ParsedFieldId::kEjection:
+        return frame.ejection;
+      default:
+        return gcs::data::GetChannelValue(
+            frame, static_cast<TelemetryChannel>(
+                       static_cast<std::size_t>(id) -
+                       static_cast<std::size_t>(ParsedFieldId::kFirstChannel)));
+      }
+    }
+
+    void SetFieldValue(TelemetryData &frame, ParsedFieldId id, double value)
+    {
+      switch (id)
+      {
+      case ParsedFieldId::kTimestampMs:
+        frame.timestamp_us = static_cast<std::uint64_t>(value) * 1000;
+        break;
+      case ParsedFieldId::kTimestampUs:
+        frame.timestamp_us = static_cast<std::uint64_t>(value);
+        break;
+      case ParsedFieldId::kRxCount:
+        frame.rx_count = static_cast<std::uint32_t>(value);
+        break;
+      case ParsedFieldId::kTxCount:
+        frame.tx_count = static_cast<std::uint32_t>(value);
+        break;
+      case ParsedFieldId::kFsm:
+        frame.fsm = static_cast<std::uint8_t>(value);
+        break;
+      case ParsedFieldId::kSensor:
+        frame.sensor = static_cast<std::uint8_t>(value);
+        break;
+      case ParsedFieldId::kEjection:
+        frame.ejection = static_cast<std::uint8_t>(value);
+        break;
+      default:
+        gcs::data::SetChannelValue(
+            frame,
+            static_cast<TelemetryChannel>(
+                static_cast<std::size_t>(id) -
+                static_cast<std::size_t>(ParsedFieldId::kFirstChannel)),
+            value);
+        break;
+      }
+    }
+  } // namespace
+
+  std::size_t DecodeLegacyRecords(std::span<const std::uint8_t> bytes,
+                                  std::span<TelemetryData> frames,
+                                  gcs::data::TimestampUnwrapper &unwrapper)
+  {
+    constexpr std::size_t kRecordSize = sizeof(LegacyTelemetryData);
+    std::size_t count = std::min(bytes.size() / kRecordSize, frames.size());
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      LegacyTelemetryData legacy;
+      std::memcpy(&legacy, bytes.data() + i * kRecordSize, kRecordSize);
+
+      TelemetryData &frame = frames[i];
+      frame.timestamp_us = unwrapper.Unwrap(legacy.timestamp) * 1000;
+      frame.pos = legacy.pos;
+      frame.vel = legacy.vel;
+      frame.acc = legacy.acc;
+      frame.quat = legacy.quat;
+      frame.euler = legacy.euler;
+      frame.rx_count = legacy.rx_count;
+      frame.tx_count = legacy.tx_count;
+      frame.fsm = legacy.fsm;
+      frame.sensor = legacy.sensor;
+      frame.ejection = legacy.ejection;
+    }
+    return count;
+  }
+
+  ParsedLogSchema::ParsedLogSchema(ParsedLogEncoding encoding)
+      : encoding_(encoding)
+  {
+    std::uint32_t offset = 0;
+    auto add = [&](ParsedFieldId id, ParsedFieldType type, double scale)
+    {
+      fields_.push_back({id, type, offset, scale});
+      offset += static_cast<std::uint32_t>(FieldSize(type));
+    };
+
+    add(ParsedFieldId::kTimestampUs, ParsedFieldType::kU64, 1.0);
+    for (std::size_t i = 0; i < gcs::data::kTelemetryChannelCount; ++i)
+    {
+      auto channel = static_cast<TelemetryChannel>(i);
+      auto id = static_cast<ParsedFieldId>(
+          static_cast<std::size_t>(ParsedFieldId::kFirstChannel) + i);
+      switch (encoding)
+      {
+      case ParsedLogEncoding::kFloat64:
+        add(id, ParsedFieldType::kF64, 1.0);
+        break;
+      case ParsedLogEncoding::kFloat32:
+        add(id, ParsedFieldType::kF32, 1.0);
+        break;
+      case ParsedLogEncoding::kFixedPoint:
+        add(id, ParsedFieldType::kFixed32, ChannelScale(channel));
+        break;
+      }
+    }
+    add(ParsedFieldId::kRxCount, ParsedFieldType::kU32, 1.0);
+    add(ParsedFieldId::kTxCount, ParsedFieldType::kU32, 1.0);
+    add(ParsedFieldId::kFsm, ParsedFieldType::kU8, 1.0);
+    add(ParsedFieldId::kSensor, ParsedFieldType::kU8, 1.0);
+    add(ParsedFieldId::kEjection, ParsedFieldType::kU8, 1.0);
+
+    record_size_ = offset;
+    IndexFields();
+  }
+
+  bool ParsedLogSchema::HasMagic(std::span<const std::uint8_t> bytes)
+  {
+    return bytes.size() >= kParsedLogMagic.size() &&
+           std::equal(kParsedLogMagic.begin(), kParsedLogMagic.end(),
+                      bytes.begin());
+  }
+
+  std::optional<ParsedLogSchema> ParsedLogSchema::ReadHeader(
+      std::span<const std::uint8_t> bytes)
+  {
+    if (bytes.size() < kFixedHeaderSize || !HasMagic(bytes))
+      return std::nullopt;
+
+    const std::uint8_t *in = bytes.data() + kParsedLogMagic.size();
+    auto version = LoadLE<std::uint16_t>(in);
+    auto header_size = LoadLE<std::uint16_t>(in + 2);
+    auto record_size = LoadLE<std::uint16_t>(in + 4);
+    auto field_count = LoadLE<std::uint16_t>(in + 6);
+    std::uint8_t encoding = in[8];
+
+    if (version == 0 || version > kParsedLogVersion ||
+        header_size != kFixedHeaderSize + field_count * kFieldEntrySize ||
+        bytes.size() < header_size ||
+        encoding > static_cast<std::uint8_t>(ParsedLogEncoding::kFixedPoint))
+      return std::nullopt;
+
+    ParsedLogSchema schema;
+    schema.version_ = version;
+    schema.encoding_ = static_cast<ParsedLogEncoding>(encoding);
+    schema.record_size_ = record_size;
+    schema.fields_.reserve(field_count);
+
+    const std::uint8_t *entry = bytes.data() + kFixedHeaderSize;
+    for (std::size_t i = 0; i < field_count; ++i, entry += kFieldEntrySize)
+    {
+      ParsedLogField field;
+      field.id = static_cast<ParsedFieldId>(LoadLE<std::uint16_t>(entry));
+      std::uint8_t type = entry[2];
+      field.offset = LoadLE<std::uint32_t>(entry + 4);
+      field.scale = std::bit_cast<double>(LoadLE<std::uint64_t>(entry + 8));
+
+      if (type > static_cast<std::uint8_t>(ParsedFieldType::kU64))
+        return std::nullopt;
+      field.type = static_cast<ParsedFieldType>(type);
+      if (field.offset + FieldSize(field.type) > record_size)
+        return std::nullopt;
+
+      schema.fields_.push_back(field);
+    }
+
+    schema.IndexFields();
+    return schema;
+  }
+
+  bool ParsedLogSchema::ReadFileHeader(std::istream &file,
+                                       std::optional<ParsedLogSchema> &schema)
+  {
+    schema.reset();
+    std::vector<std::uint8_t> header(kFixedHeaderSize);
+    file.read(reinterpret_cast<char *>(header.data()), header.size());
+    header.resize(static_cast<std::size_t>(file.gcount()));
+    file.clear();
+
+    // Files without the magic are legacy dumps of TelemetryData structs.
+    if (!HasMagic(header))
+    {
+      file.seekg(0, std::ios::beg);
+      return true;
+    }
+    if (header.size() < kFixedHeaderSize)
+      return false;
+
+    std::size_t header_size = LoadLE<std::uint16_t>(header.data() + 10);
+    if (header_size < kFixedHeaderSize)
+      return false;
+    header.resize(header_size);
+    file.read(reinterpret_cast<char *>(header.data()) + kFixedHeaderSize,
+              header_size - kFixedHeaderSize);
+
+    schema = ReadHeader(header);
+    if (!schema || schema->GetRecordSize() == 0)
+    {
+      schema.reset();
+      return false;
+    }
+    file.clear();
+    file.seekg(header_size, std::ios::beg);
+    return true;
+  }
+
+  std::vector<std::uint8_t> ParsedLogSchema::WriteHeader() const
+  {
+    std::vector<std::uint8_t> header(GetHeaderSize(), 0);
+    std::copy(kParsedLogMagic.begin(), kParsedLogMagic.end(), header.begin());
+
+    std::uint8_t *out = header.data() + kParsedLogMagic.size();
+    StoreLE(out, version_);
+    StoreLE(out + 2, static_cast<std::uint16_t>(GetHeaderSize()));
+    StoreLE(out + 4, static_cast<std::uint16_t>(record_size_));
+    StoreLE(out + 6, static_cast<std::uint16_t>(fields_.size()));
+    out[8] = static_cast<std::uint8_t>(encoding_);
+
+    std::uint8_t *entry = header.data() + kFixedHeaderSize;
+    for (const ParsedLogField &field : fields_)
+    {
+      StoreLE(entry, static_cast<std::uint16_t>(field.id));
+      entry[2] = static_cast<std::uint8_t>(field.type);
+      StoreLE(entry + 4, field.offset);
+      StoreLE(entry + 8, std::bit_cast<std::uint64_t>(field.scale));
+      entry += kFieldEntrySize;
+    }
+    return header;
+  }
+
+  void ParsedLogSchema::Encode(const TelemetryData &frame,
+                               std::span<std::uint8_t> record) const
+  {
+    std::fill_n(record.begin(), record_size_, std::uint8_t{0});
+    for (const ParsedLogField &field : fields_)
+    {
+      WriteField(field, record.data() + field.offset,
+                 GetFieldValue(frame, field.id));
+    }
+  }
+
+  void ParsedLogSchema::Decode(std::span<const std::uint8_t> record,
+                               TelemetryData &frame) const
+  {
+    frame = TelemetryData{};
+    for (const ParsedLogField &field : fields_)
+    {
+      if (field.id < ParsedFieldId::kCount)
+      {
+        SetFieldValue(frame, field.id,
+                      ReadField(field, record.data() + field.offset));
+      }
+    }
+  }
+
+  std::size_t ParsedLogSchema::DecodeRecords(
+      std::span<const std::uint8_t> bytes,
+      std::span<TelemetryData> frames,
+      gcs::data::TimestampUnwrapper &unwrapper) const
+  {
+    if (record_size_ == 0)
+      return 0;
+
+    // Decode() stores a version 1 timestamp as ms * 1000 of the raw value.
+    const bool unwrap_ms = !FindField(ParsedFieldId::kTimestampUs) &&
+                           FindField(ParsedFieldId::kTimestampMs);
+    std::size_t count = std::min(bytes.size() / record_size_, frames.size());
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      Decode(bytes.subspan(i * record_size_, record_size_), frames[i]);
+      if (unwrap_ms)
+      {
+        frames[i].timestamp_us =
+            unwrapper.Unwrap(frames[i].timestamp_us / 1000) * 1000;
+      }
+    }
+    return count;
+  }
+
+  std::uint64_t ParsedLogSchema::ReadTimestamp(
+      std::span<const std::uint8_t> record) const
+  {
+    if (const ParsedLogField *field = FindField(ParsedFieldId::kTimestampUs))
+    {
+      return static_cast<std::uint64_t>(
+          ReadField(*field, record.data() + field->offset));
+    }
+    if (const ParsedLogField *field = FindField(ParsedFieldId::kTimestampMs))
+    {
+      return static_cast<std::uint64_t>(
+                 ReadField(*field, record.data() + field->offset)) *
+             1000;
+    }
+    return 0;
+  }
+
+  double ParsedLogSchema::ReadChannel(std::span<const std::uint8_t> record,
+                                      TelemetryChannel channel) const
+  {
+    const ParsedLogField *field = FindField(static_cast<ParsedFieldId>(
+        static_cast<std::size_t>(ParsedFieldId::kFirstChannel) +
+        static_cast<std::size_t>(channel)));
+    if (!field)
+      return 0.0;
+    return ReadField(*field, record.data() + field->offset);
+  }
+
+  void ParsedLogSchema::IndexFields()
+  {
+    index_.fill(-1);
+    for (std::size_t i = 0; i < fields_.size(); ++i)
+    {
+      auto id = static_cast<std::size_t>(fields_[i].id);
+      if (id < index_.size())
+      {
+        index_[id] = static_cast<int>(i);
+      }
+    }
+  }
+
+  const ParsedLogField *ParsedLogSchema::FindField(ParsedFieldId id) const
+  {
+    auto index = static_cast<std::size_t>(id);
+    if (index >= index_.size() || index_[index] < 0)
+      return nullptr;
+    return &fields_[static_cast<std::size_t>(index_[index])];
+  }
+
+} // namespace gcs::logging
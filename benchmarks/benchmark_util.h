@@ -0,0 +1,89 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_BENCHMARKS_BENCHMARK_UTIL_H_
+#define GCS_CORE_BENCHMARKS_BENCHMARK_UTIL_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+/**
+ * @file benchmark_util.h
+ * @brief Timing helpers shared by the benchmark executables, which print
+ * one result per line.
+ */
+
+namespace gcs::benchmarks
+{
+
+  /**
+   * @brief Sink for results that must not be optimized away.
+   */
+  inline volatile std::uint64_t g_sink = 0;
+
+  template <typename T>
+  void Consume(const T &value)
+  {
+    g_sink = g_sink + static_cast<std::uint64_t>(value);
+  }
+
+  /**
+   * @brief Runs fn repeatedly for at least min_time and returns the mean
+   * time per item.
+   * @param items_per_call Items processed by one call of fn.
+   * @param fn Work to measure; called once untimed to warm up.
+   */
+  template <typename Fn>
+  double MeasureNsPerItem(std::size_t items_per_call, Fn &&fn,
+                          std::chrono::milliseconds min_time =
+                              std::chrono::milliseconds(300))
+  {
+    using Clock = std::chrono::steady_clock;
+    fn();
+
+    std::size_t calls = 0;
+    auto start = Clock::now();
+    auto elapsed = Clock::duration::zero();
+    do
+    {
+      fn();
+      ++calls;
+      elapsed = Clock::now() - start;
+    } while (elapsed < min_time);
+
+    auto ns = std::chrono::duration<double, std::nano>(elapsed).count();
+    return ns / static_cast<double>(calls * items_per_call);
+  }
+
+  /**
+   * @brief Prints one result line.
+   */
+  inline void Report(const char *name, double ns_per_item, const char *item)
+  {
+    std::printf("%-44s %10.2f ns/%s\n", name, ns_per_item, item);
+  }
+
+  /**
+   * @brief Prints one result line as a rate, in millions of items per
+   * second.
+   */
+  inline void ReportRate(const char *name, double ns_per_item,
+                         const char *item)
+  {
+    std::printf("%-44s %10.2f M%s/s\n", name, 1e3 / ns_per_item, item);
+  }
+
+  /**
+   * @brief Prints one throughput line for a result measured per byte.
+   */
+  inline void ReportThroughput(const char *name, double ns_per_byte)
+  {
+    std::printf("%-44s %10.3f GB/s\n", name, 1.0 / ns_per_byte);
+  }
+
+} // namespace gcs::benchmarks
+
+#endif // GCS_CORE_BENCHMARKS_BENCHMARK_UTIL_H_
@@ -0,0 +1,148 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+// Measures the producer-side cost of ConflatingSignal::Publish with 0 and
+// 8 consumers attached, against Signal::Invoke with 8 self-throttling
+// listeners, and the latency from Publish to a consumer seeing the value.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "benchmark_util.h"
+#include "common/event.h"
+#include "data/telemetry.h"
+
+namespace
+{
+  using gcs::common::ConflatingSignal;
+  using gcs::common::Signal;
+  using gcs::common::SignalToken;
+  using gcs::data::TelemetryData;
+  using Clock = std::chrono::steady_clock;
+  using namespace gcs::benchmarks;
+
+  constexpr std::size_t kPublishesPerCall = 1000;
+  constexpr double kDisplayRateHz = 60.0;
+
+  std::int64_t NowNs()
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               Clock::now().time_since_epoch())
+        .count();
+  }
+
+  void RunPublish(int consumers)
+  {
+    ConflatingSignal<TelemetryData> signal;
+    std::atomic<std::uint64_t> calls = 0;
+    std::vector<SignalToken> tokens;
+    for (int i = 0; i < consumers; ++i)
+    {
+      tokens.push_back(signal.Connect([&calls](const TelemetryData &)
+                                      { calls.fetch_add(1, std::memory_order_relaxed); },
+                                      kDisplayRateHz));
+    }
+
+    TelemetryData frame;
+    double ns = MeasureNsPerItem(kPublishesPerCall, [&]()
+                                 {
+                                   for (std::size_t i = 0; i < kPublishesPerCall; ++i)
+                                   {
+                                     ++frame.rx_count;
+                                     signal.Publish(frame);
+                                   } });
+    tokens.clear();
+    Consume(calls.load());
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "Publish, %d consumers at 60 Hz", consumers);
+    Report(name, ns, "publish");
+  }
+
+  // What a UI listener on OnTelemetry pays today: every frame is delivered
+  // and dropped unless the display period has passed.
+  void RunThrottledSignal(int listeners)
+  {
+    Signal<const TelemetryData &> signal;
+    const auto period = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / kDisplayRateHz));
+    std::vector<Clock::time_point> next(listeners, Clock::now());
+    std::uint64_t shown = 0;
+    std::vector<SignalToken> tokens;
+    for (int i = 0; i < listeners; ++i)
+    {
+      tokens.push_back(signal.Connect([&next, &shown, period, i](const TelemetryData &)
+                                      {
+                                        auto now = Clock::now();
+                                        if (now < next[i])
+                                          return;
+                                        next[i] = now + period;
+                                        ++shown; }));
+    }
+
+    TelemetryData frame;
+    double ns = MeasureNsPerItem(kPublishesPerCall, [&]()
+                                 {
+                                   for (std::size_t i = 0; i < kPublishesPerCall; ++i)
+                                   {
+                                     ++frame.rx_count;
+                                     signal.Invoke(frame);
+                                   } });
+    Consume(shown);
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "Signal::Invoke, %d throttled listeners",
+                  listeners);
+    Report(name, ns, "publish");
+  }
+
+  struct Stamp
+  {
+    std::int64_t published_ns = 0;
+  };
+
+  // Publishes a timestamp every 100 us for a while and records the age of
+  // the value each consumer call receives. Half the publish interval is
+  // the floor.
+  void RunLatency(double rate_hz)
+  {
+    ConflatingSignal<Stamp> signal;
+    std::atomic<std::int64_t> total_ns = 0;
+    std::atomic<std::int64_t> calls = 0;
+    auto token = signal.Connect([&total_ns, &calls](const Stamp &stamp)
+                                {
+                                  total_ns.fetch_add(NowNs() - stamp.published_ns,
+                                                     std::memory_order_relaxed);
+                                  calls.fetch_add(1, std::memory_order_relaxed); },
+                                rate_hz);
+
+    const auto end = Clock::now() + std::chrono::milliseconds(500);
+    while (Clock::now() < end)
+    {
+      signal.Publish(Stamp{NowNs()});
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    token.reset();
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "value age at consumer, %.0f Hz", rate_hz);
+    const std::int64_t n = calls.load();
+    Report(name, n > 0 ? static_cast<double>(total_ns.load()) / n : 0.0,
+           "call");
+  }
+} // namespace
+
+int main()
+{
+  RunPublish(0);
+  RunPublish(8);
+  RunThrottledSignal(8);
+  RunLatency(kDisplayRateHz);
+  RunLatency(1000.0);
+  return 0;
+}
@@ -0,0 +1,121 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+// Measures converter-side type dispatch over 32 packet types arriving in
+// random order: PacketDispatcher's jump table, a std::map of handlers keyed
+// by packet ID, and a chain of std::dynamic_pointer_cast.
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "benchmark_util.h"
+#include "interfaces/packet_dispatcher.h"
+
+namespace
+{
+  using gcs::interfaces::IPacket;
+  using gcs::interfaces::PacketDispatcher;
+  using gcs::interfaces::PacketEntry;
+  using namespace gcs::benchmarks;
+
+  constexpr int kTypes = 32;
+  constexpr std::size_t kPackets = 4096;
+
+  template <int Id>
+  class TypedPacket : public IPacket
+  {
+  public:
+    std::size_t SerializedSize() const override { return 0; }
+    std::size_t SerializeTo(std::span<std::uint8_t>) const override { return 0; }
+    bool DeserializeFrom(std::span<const std::uint8_t>) override { return true; }
+    int GetId() const override { return Id; }
+
+    std::uint64_t value = Id;
+  };
+
+  template <int... Ids>
+  struct Protocol
+  {
+    using Dispatcher = PacketDispatcher<PacketEntry<Ids, TypedPacket<Ids>>...>;
+
+    static std::shared_ptr<IPacket> Make(int id)
+    {
+      std::shared_ptr<IPacket> packet;
+      ((id == Ids ? (packet = std::make_shared<TypedPacket<Ids>>(), 0) : 0), ...);
+      return packet;
+    }
+
+    static std::map<int, std::function<void(const IPacket &)>> MakeHandlers(
+        std::uint64_t &sum)
+    {
+      std::map<int, std::function<void(const IPacket &)>> handlers;
+      ((handlers[Ids] = [&sum](const IPacket &packet)
+        { sum += static_cast<const TypedPacket<Ids> &>(packet).value; }),
+       ...);
+      return handlers;
+    }
+
+    static void CastChain(const std::shared_ptr<IPacket> &packet,
+                          std::uint64_t &sum)
+    {
+      // Stops at the first matching cast, like an if/else-if chain.
+      (void)((std::dynamic_pointer_cast<TypedPacket<Ids>>(packet)
+                  ? (sum += std::dynamic_pointer_cast<TypedPacket<Ids>>(packet)->value, true)
+                  : false) ||
+             ...);
+    }
+  };
+
+  template <int... Ids>
+  Protocol<(Ids + 1)...> MakeProtocol(std::integer_sequence<int, Ids...>);
+
+  using Packets = decltype(MakeProtocol(std::make_integer_sequence<int, kTypes>{}));
+} // namespace
+
+int main()
+{
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<int> pick(1, kTypes);
+  std::vector<std::shared_ptr<IPacket>> stream;
+  for (std::size_t i = 0; i < kPackets; ++i)
+  {
+    stream.push_back(Packets::Make(pick(rng)));
+  }
+
+  std::uint64_t sum = 0;
+  Report("PacketDispatcher", MeasureNsPerItem(kPackets, [&]()
+                                              {
+                                                for (const auto &packet : stream)
+                                                {
+                                                  Packets::Dispatcher::Dispatch(*packet, [&sum](const auto &typed)
+                                                                                { sum += typed.value; });
+                                                } }),
+         "packet");
+
+  auto handlers = Packets::MakeHandlers(sum);
+  Report("std::map<id, std::function>", MeasureNsPerItem(kPackets, [&]()
+                                                         {
+                                                           for (const auto &packet : stream)
+                                                           {
+                                                             auto it = handlers.find(packet->GetId());
+                                                             if (it != handlers.end())
+                                                               it->second(*packet);
+                                                           } }),
+         "packet");
+
+  Report("dynamic_pointer_cast chain", MeasureNsPerItem(kPackets, [&]()
+                                                        {
+                                                          for (const auto &packet : stream)
+                                                          {
+                                                            Packets::CastChain(packet, sum);
+                                                          } }),
+         "packet");
+  Consume(sum);
+  return 0;
+}
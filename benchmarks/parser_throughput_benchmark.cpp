@@ -0,0 +1,74 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+// Measures IParser::PushData throughput when a stream is fed in chunks of
+// 256 B to 64 KiB, passing spans straight into the buffer as a memory-mapped
+// log would, against copying every chunk into a vector first.
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "benchmark_util.h"
+#include "support/sample_protocol.h"
+
+namespace
+{
+  using gcs::interfaces::IPacket;
+  using namespace gcs::benchmarks;
+  using namespace gcs::testing;
+
+  // About 4 MiB of frames.
+  constexpr std::size_t kFrames = (4 << 20) / kSampleFrameSize;
+
+  template <typename Feed>
+  void Run(const char *how, std::size_t chunk,
+           const std::vector<std::uint8_t> &bytes, Feed feed)
+  {
+    SampleParser parser;
+    std::uint64_t packets = 0;
+    auto token = parser.OnPacketReceived.Connect(
+        [&packets](const std::shared_ptr<IPacket> &)
+        { ++packets; });
+
+    const double ns = MeasureNsPerItem(bytes.size(), [&]()
+                                       {
+                                         std::span<const std::uint8_t> rest(bytes);
+                                         while (!rest.empty())
+                                         {
+                                           const std::size_t n = std::min(chunk, rest.size());
+                                           feed(parser, rest.first(n));
+                                           rest = rest.subspan(n);
+                                         } });
+    Consume(packets);
+
+    const std::string name =
+        std::string(how) + ", " + std::to_string(chunk) + " B chunks";
+    ReportThroughput(name.c_str(), ns);
+  }
+} // namespace
+
+int main()
+{
+  const std::vector<std::uint8_t> bytes = MakeSampleStream(kFrames);
+
+  for (std::size_t chunk : {256, 4096, 65536})
+  {
+    Run("span", chunk, bytes,
+        [](SampleParser &parser, std::span<const std::uint8_t> data)
+        { parser.PushData(data); });
+
+    // What LogPlayer used to do: materialize every chunk.
+    Run("vector copy", chunk, bytes,
+        [](SampleParser &parser, std::span<const std::uint8_t> data)
+        {
+          std::vector<std::uint8_t> copy(data.begin(), data.end());
+          parser.PushData(copy);
+        });
+  }
+  return 0;
+}
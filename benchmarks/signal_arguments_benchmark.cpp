@@ -0,0 +1,114 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+// Measures what Signal::Invoke costs per packet in the parse chain when
+// listeners take the packet by const reference, as the logger and player
+// do, against listeners that take their own shared_ptr copy. Also counts
+// the argument copies Invoke makes.
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "benchmark_util.h"
+#include "common/event.h"
+#include "support/sample_protocol.h"
+
+namespace
+{
+  using gcs::common::Signal;
+  using gcs::common::SignalToken;
+  using gcs::interfaces::IPacket;
+  using namespace gcs::benchmarks;
+  using namespace gcs::testing;
+
+  constexpr std::size_t kFrames = 4096;
+  constexpr int kListeners = 4;
+
+  // Counts copies of itself, standing in for a payload that is expensive
+  // to copy.
+  struct Counted
+  {
+    static inline std::uint64_t copies = 0;
+
+    Counted() = default;
+    Counted(const Counted &) { ++copies; }
+    Counted(Counted &&) noexcept = default;
+    Counted &operator=(const Counted &)
+    {
+      ++copies;
+      return *this;
+    }
+    Counted &operator=(Counted &&) noexcept = default;
+  };
+
+  void ReportCopies(const char *name, double copies)
+  {
+    std::printf("%-44s %10.2f copies/invoke\n", name, copies);
+  }
+
+  template <typename Listener>
+  void RunParseChain(const char *name, const std::vector<std::uint8_t> &bytes,
+                     Listener listener)
+  {
+    SampleParser parser;
+    std::vector<SignalToken> tokens;
+    for (int i = 0; i < kListeners; ++i)
+    {
+      tokens.push_back(parser.OnPacketReceived.Connect(listener));
+    }
+    Report(name, MeasureNsPerItem(kFrames, [&]()
+                                  { parser.PushData(bytes); }),
+           "packet");
+  }
+
+  template <typename Listener, typename Invoke>
+  void RunCopies(const char *name, Listener listener, Invoke invoke)
+  {
+    Signal<Counted> signal;
+    std::vector<SignalToken> tokens;
+    for (int i = 0; i < kListeners; ++i)
+    {
+      tokens.push_back(signal.Connect(listener));
+    }
+    constexpr int kInvokes = 1000;
+    Counted::copies = 0;
+    for (int i = 0; i < kInvokes; ++i)
+    {
+      invoke(signal);
+    }
+    ReportCopies(name, static_cast<double>(Counted::copies) / kInvokes);
+  }
+} // namespace
+
+int main()
+{
+  const std::vector<std::uint8_t> bytes = MakeSampleStream(kFrames);
+  std::uint64_t sum = 0;
+
+  // Each by-value listener costs an atomic increment and decrement.
+  RunParseChain("parse chain, 4 const& listeners", bytes,
+                [&sum](const std::shared_ptr<IPacket> &packet)
+                { sum += static_cast<std::uint64_t>(packet->GetId()); });
+  RunParseChain("parse chain, 4 by-value listeners", bytes,
+                [&sum](std::shared_ptr<IPacket> packet)
+                { sum += static_cast<std::uint64_t>(packet->GetId()); });
+  Consume(sum);
+
+  auto by_reference = [](const Counted &) {};
+  auto by_value = [](Counted) {};
+  auto invoke_lvalue = [](Signal<Counted> &signal)
+  {
+    Counted value;
+    signal.Invoke(static_cast<const Counted &>(value));
+  };
+  auto invoke_rvalue = [](Signal<Counted> &signal)
+  { signal.Invoke(Counted{}); };
+  RunCopies("Invoke(lvalue), 4 const& listeners", by_reference, invoke_lvalue);
+  RunCopies("Invoke(rvalue), 4 const& listeners", by_reference, invoke_rvalue);
+  RunCopies("Invoke(lvalue), 4 by-value listeners", by_value, invoke_lvalue);
+  RunCopies("Invoke(rvalue), 4 by-value listeners", by_value, invoke_rvalue);
+  return 0;
+}
@@ -0,0 +1,80 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+// Measures Signal::Invoke throughput for 1, 4 and 16 listeners, alone and
+// while another thread keeps connecting and disconnecting a listener.
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark_util.h"
+#include "common/event.h"
+#include "data/telemetry.h"
+
+namespace
+{
+  using gcs::data::TelemetryData;
+  using namespace gcs::benchmarks;
+
+  constexpr std::size_t kInvokesPerCall = 1000;
+
+  void Run(std::size_t listeners, bool churn)
+  {
+    gcs::common::Signal<const TelemetryData &> signal;
+    std::uint64_t sum = 0;
+    std::vector<gcs::common::SignalToken> tokens;
+    for (std::size_t i = 0; i < listeners; ++i)
+    {
+      tokens.push_back(signal.Connect([&sum](const TelemetryData &frame)
+                                      { sum += frame.rx_count; }));
+    }
+
+    std::atomic<bool> stop = false;
+    std::thread churner;
+    if (churn)
+    {
+      churner = std::thread([&signal, &stop]()
+                            {
+                              while (!stop.load(std::memory_order_relaxed))
+                              {
+                                auto token = signal.Connect([](const TelemetryData &) {});
+                                token.reset();
+                              } });
+    }
+
+    TelemetryData frame;
+    frame.rx_count = 1;
+    double ns = MeasureNsPerItem(kInvokesPerCall, [&]()
+                                 {
+                                   for (std::size_t i = 0; i < kInvokesPerCall; ++i)
+                                   {
+                                     signal.Invoke(frame);
+                                   } });
+
+    stop = true;
+    if (churner.joinable())
+      churner.join();
+    Consume(sum);
+
+    std::string name = std::to_string(listeners) + " listener" +
+                       (listeners == 1 ? "" : "s") +
+                       (churn ? ", connect/disconnect churn" : "");
+    ReportRate(name.c_str(), ns, "invoke");
+  }
+} // namespace
+
+int main()
+{
+  for (bool churn : {false, true})
+  {
+    for (std::size_t listeners : {1, 4, 16})
+    {
+      Run(listeners, churn);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,77 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+// Measures Signal connect, disconnect and invoke costs at 1 to 1000
+// listeners. Disconnecting one listener should cost the same at any count.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark_util.h"
+#include "common/event.h"
+
+namespace
+{
+  using gcs::common::Signal;
+  using gcs::common::SignalToken;
+  using namespace gcs::benchmarks;
+
+  std::string Label(const char *what, std::size_t listeners)
+  {
+    return std::string(what) + ", " + std::to_string(listeners) + " listener" +
+           (listeners == 1 ? "" : "s");
+  }
+
+  void Run(std::size_t listeners)
+  {
+    Signal<int> signal;
+    std::uint64_t sum = 0;
+
+    // Connecting and then dropping every listener, with mixed priorities.
+    std::vector<SignalToken> tokens;
+    tokens.reserve(listeners);
+    double ns = MeasureNsPerItem(listeners, [&]()
+                                 {
+                                   for (std::size_t i = 0; i < listeners; ++i)
+                                   {
+                                     tokens.push_back(signal.Connect(
+                                         [&sum](int v)
+                                         { sum += static_cast<std::uint64_t>(v); },
+                                         {.name = "", .priority = static_cast<int>(i % 4)}));
+                                   }
+                                   tokens.clear(); });
+    Report(Label("connect + disconnect all", listeners).c_str(), ns, "listener");
+
+    for (std::size_t i = 0; i < listeners; ++i)
+    {
+      tokens.push_back(signal.Connect([&sum](int v)
+                                      { sum += static_cast<std::uint64_t>(v); },
+                                      {.name = "", .priority = static_cast<int>(i % 4)}));
+    }
+
+    // One more listener joining and leaving the populated signal.
+    ns = MeasureNsPerItem(1, [&]()
+                          {
+                            auto token = signal.Connect([&sum](int v)
+                                                        { sum += static_cast<std::uint64_t>(v); },
+                                                        {.name = "", .priority = 2});
+                            token.reset(); });
+    Report(Label("connect + disconnect one", listeners).c_str(), ns, "pair");
+
+    ns = MeasureNsPerItem(listeners, [&]()
+                          { signal.Invoke(1); });
+    Report(Label("invoke", listeners).c_str(), ns, "listener");
+    Consume(sum);
+  }
+} // namespace
+
+int main()
+{
+  for (std::size_t listeners : {1, 10, 100, 1000})
+  {
+    Run(listeners);
+  }
+  return 0;
+}
@@ -0,0 +1,72 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+// Compares the per-frame cost of the compile-time StaticPipeline with the
+// Signal-based IParser -> IConverter chain for the same protocol.
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "benchmark_util.h"
+#include "common/event.h"
+#include "common/static_signal.h"
+#include "support/sample_protocol.h"
+
+namespace
+{
+  using gcs::data::TelemetryData;
+  using namespace gcs::benchmarks;
+  using namespace gcs::testing;
+
+  constexpr std::size_t kFrames = 4096;
+} // namespace
+
+int main()
+{
+  const std::vector<std::uint8_t> bytes = MakeSampleStream(kFrames);
+
+  {
+    std::uint64_t sum = 0;
+    gcs::common::StaticPipeline pipeline(SampleParser{}, SampleConverter{},
+                                         [&sum](const TelemetryData &frame)
+                                         { sum += frame.timestamp_us; });
+    Report("static pipeline", MeasureNsPerItem(kFrames, [&]()
+                                               { pipeline.PushData(bytes); }),
+           "frame");
+    Consume(sum);
+  }
+
+  {
+    std::uint64_t sum = 0;
+    gcs::common::Signal<const TelemetryData &> on_telemetry;
+    auto token = on_telemetry.Connect([&sum](const TelemetryData &frame)
+                                      { sum += frame.timestamp_us; });
+    gcs::common::StaticPipeline pipeline(SampleParser{}, SampleConverter{},
+                                         gcs::common::DynamicSink(on_telemetry));
+    Report("static pipeline + DynamicSink",
+           MeasureNsPerItem(kFrames, [&]()
+                            { pipeline.PushData(bytes); }),
+           "frame");
+    Consume(sum);
+  }
+
+  {
+    std::uint64_t sum = 0;
+    SampleParser parser;
+    SampleConverter converter;
+    auto parsed = parser.OnPacketReceived.Connect(
+        [&converter](const std::shared_ptr<gcs::interfaces::IPacket> &packet)
+        { converter.Convert(packet); });
+    auto converted = converter.OnTelemetryConverted.Connect(
+        [&sum](const TelemetryData &frame)
+        { sum += frame.timestamp_us; });
+    Report("IParser -> Signal -> IConverter -> Signal",
+           MeasureNsPerItem(kFrames, [&]()
+                            { parser.PushData(bytes); }),
+           "frame");
+    Consume(sum);
+  }
+  return 0;
+}
@@ -0,0 +1,90 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+// Measures the compression ratio and encode/decode throughput of the
+// telemetry codec on a synthetic flight. Throughput is given in bytes of
+// raw TelemetryData per second.
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark_util.h"
+#include "data/telemetry_codec.h"
+
+namespace
+{
+  using gcs::data::TelemetryData;
+  using namespace gcs::benchmarks;
+
+  constexpr std::size_t kFrames = 100000;
+
+  // 100 Hz with timing jitter: smooth kinematics, float-quantized IMU noise.
+  std::vector<TelemetryData> MakeFlight(bool noisy)
+  {
+    std::mt19937_64 rng(1);
+    std::normal_distribution<float> noise(0.0f, noisy ? 0.02f : 0.0f);
+    std::uniform_int_distribution<std::uint64_t> jitter(0, 200);
+    std::vector<TelemetryData> frames(kFrames);
+    for (std::size_t i = 0; i < kFrames; ++i)
+    {
+      const double t = static_cast<double>(i) * 0.01;
+      TelemetryData &frame = frames[i];
+      frame.timestamp_us = i * 10000 + jitter(rng);
+      frame.pos.data = {10.0 * std::sin(0.01 * t), 0.0, 0.5 * t * t};
+      frame.vel.data = {0.1 * std::cos(0.01 * t), 0.0, t};
+      frame.acc.data = {noise(rng), noise(rng), 1.0f + noise(rng)};
+      frame.quat.data = {std::cos(0.001 * t), 0.0, 0.0, std::sin(0.001 * t)};
+      frame.euler.data = {noise(rng), noise(rng), 0.002 * t};
+      frame.rx_count = static_cast<std::uint32_t>(i);
+      frame.tx_count = static_cast<std::uint32_t>(i / 100);
+      frame.fsm = static_cast<std::uint8_t>(i / 20000);
+      frame.sensor = 0x0F;
+    }
+    return frames;
+  }
+
+  void Run(const char *name, const std::vector<TelemetryData> &frames,
+           std::size_t block_frames)
+  {
+    const std::vector<std::uint8_t> stream =
+        gcs::data::EncodeTelemetry(frames, block_frames);
+    const double raw_bytes =
+        static_cast<double>(frames.size() * sizeof(TelemetryData));
+    std::printf("%-44s %10.2f x (%.1f B/frame)\n", name,
+                raw_bytes / static_cast<double>(stream.size()),
+                static_cast<double>(stream.size()) /
+                    static_cast<double>(frames.size()));
+
+    gcs::data::TelemetryEncoder encoder(block_frames);
+    const double encode_ns = MeasureNsPerItem(frames.size(), [&]()
+                                              {
+                                                encoder.Encode(frames);
+                                                encoder.Flush();
+                                                Consume(encoder.TakeOutput().size()); });
+    ReportThroughput((std::string(name) + " encode").c_str(),
+                     encode_ns / sizeof(TelemetryData));
+
+    std::vector<TelemetryData> decoded(frames.size());
+    const double decode_ns = MeasureNsPerItem(frames.size(), [&]()
+                                              {
+                                                gcs::data::TelemetryDecoder decoder(stream);
+                                                Consume(decoder.Decode(decoded)); });
+    ReportThroughput((std::string(name) + " decode").c_str(),
+                     decode_ns / sizeof(TelemetryData));
+  }
+} // namespace
+
+int main()
+{
+  const std::vector<TelemetryData> noisy = MakeFlight(true);
+  const std::vector<TelemetryData> clean = MakeFlight(false);
+  Run("noisy IMU, 1024-frame blocks", noisy, 1024);
+  Run("noisy IMU, 8-frame blocks", noisy, 8);
+  Run("noise-free, 1024-frame blocks", clean, 1024);
+  return 0;
+}
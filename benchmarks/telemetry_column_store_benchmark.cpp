@@ -0,0 +1,86 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+// Compares scanning one channel of a flight history stored column-wise in
+// TelemetryColumnStore with scanning a std::vector<TelemetryData>.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark_util.h"
+#include "data/telemetry_column_store.h"
+
+namespace
+{
+  using gcs::data::TelemetryChannel;
+  using gcs::data::TelemetryColumnStore;
+  using gcs::data::TelemetryData;
+  using namespace gcs::benchmarks;
+
+  // About 20 minutes at 1 kHz.
+  constexpr std::size_t kFrames = 1200000;
+
+  std::vector<TelemetryData> MakeFrames()
+  {
+    std::vector<TelemetryData> frames(kFrames);
+    for (std::size_t i = 0; i < kFrames; ++i)
+    {
+      const double x = static_cast<double>(i);
+      frames[i].timestamp_us = i * 1000;
+      frames[i].pos.data = {std::sin(0.001 * x), std::cos(0.001 * x), 0.01 * x};
+      frames[i].acc.data = {0.0, 0.0, -9.8 + std::sin(0.1 * x)};
+    }
+    return frames;
+  }
+} // namespace
+
+int main()
+{
+  const std::vector<TelemetryData> aos = MakeFrames();
+  TelemetryColumnStore store;
+  store.Append(aos);
+
+  Report("max pos.z, AoS vector", MeasureNsPerItem(kFrames, [&]()
+                                                   {
+                                                     double peak = -INFINITY;
+                                                     for (const TelemetryData &frame : aos)
+                                                       peak = std::max(peak, frame.pos.z());
+                                                     Consume(peak); }),
+         "frame");
+
+  Report("max pos.z, column store", MeasureNsPerItem(kFrames, [&]()
+                                                     {
+                                                       double peak = -INFINITY;
+                                                       auto column = store.GetChannel(TelemetryChannel::kPosZ);
+                                                       for (std::size_t c = 0; c < column.GetChunkCount(); ++c)
+                                                       {
+                                                         for (double v : column.GetChunk(c))
+                                                           peak = std::max(peak, v);
+                                                       }
+                                                       Consume(peak); }),
+         "frame");
+
+  Report("mean acc.z, AoS vector", MeasureNsPerItem(kFrames, [&]()
+                                                    {
+                                                      double sum = 0.0;
+                                                      for (const TelemetryData &frame : aos)
+                                                        sum += frame.acc.z();
+                                                      Consume(sum / kFrames); }),
+         "frame");
+
+  Report("mean acc.z, column store", MeasureNsPerItem(kFrames, [&]()
+                                                      {
+                                                        double sum = 0.0;
+                                                        auto column = store.GetChannel(TelemetryChannel::kAccZ);
+                                                        for (std::size_t c = 0; c < column.GetChunkCount(); ++c)
+                                                        {
+                                                          for (double v : column.GetChunk(c))
+                                                            sum += v;
+                                                        }
+                                                        Consume(sum / kFrames); }),
+         "frame");
+  return 0;
+}
@@ -0,0 +1,96 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+// Measures the frame kernels of telemetry_math in frames per second, at
+// every SIMD level the CPU supports.
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "benchmark_util.h"
+#include "data/telemetry_math.h"
+
+namespace
+{
+  using gcs::data::SimdLevel;
+  using gcs::data::TelemetryData;
+  using gcs::data::Vec3;
+  using namespace gcs::benchmarks;
+
+  constexpr std::size_t kFrames = 1 << 14;
+
+  std::vector<TelemetryData> MakeFrames()
+  {
+    std::vector<TelemetryData> frames(kFrames);
+    for (std::size_t i = 0; i < kFrames; ++i)
+    {
+      const double x = static_cast<double>(i);
+      TelemetryData &frame = frames[i];
+      frame.acc.data = {std::sin(x), std::cos(x), -9.8};
+      frame.quat.data = {2.0 * std::cos(0.001 * x), 0.1, 0.0,
+                         2.0 * std::sin(0.001 * x)};
+    }
+    return frames;
+  }
+
+  const char *LevelName(SimdLevel level)
+  {
+    switch (level)
+    {
+    case SimdLevel::kAvx2:
+      return "avx2";
+    case SimdLevel::kSse4:
+      return "sse4";
+    case SimdLevel::kScalar:
+      break;
+    }
+    return "scalar";
+  }
+
+  template <typename Fn>
+  void Run(const char *name, Fn fn)
+  {
+    const double ns = MeasureNsPerItem(kFrames, fn);
+    const std::string label =
+        std::string(name) + " (" + LevelName(gcs::data::GetSimdLevel()) + ")";
+    ReportRate(label.c_str(), ns, "frame");
+  }
+} // namespace
+
+int main()
+{
+  const std::vector<TelemetryData> input = MakeFrames();
+  std::vector<TelemetryData> frames = input;
+  std::vector<Vec3> world(kFrames);
+  std::vector<double> norms(kFrames);
+
+  const SimdLevel supported = gcs::data::GetSupportedSimdLevel();
+  for (SimdLevel level : {SimdLevel::kScalar, SimdLevel::kSse4,
+                          SimdLevel::kAvx2})
+  {
+    if (level > supported)
+      break;
+    gcs::data::SetSimdLevel(level);
+
+    Run("normalize quaternions", [&]()
+        {
+          frames = input;
+          gcs::data::NormalizeQuaternions(frames);
+          Consume(frames.back().quat[0]); });
+    Run("euler from quaternions", [&]()
+        {
+          gcs::data::UpdateEulerFromQuaternions(frames);
+          Consume(frames.back().euler[2]); });
+    Run("rotate acceleration to world", [&]()
+        {
+          gcs::data::RotateAccelerationToWorld(frames, world);
+          Consume(world.back()[2]); });
+    Run("acceleration norms", [&]()
+        {
+          gcs::data::ComputeNorms(world, norms);
+          Consume(norms.back()); });
+  }
+  return 0;
+}
@@ -0,0 +1,93 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+// Measures TelemetryResampler throughput per input frame for up- and
+// downsampling, at every SIMD level the CPU supports.
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark_util.h"
+#include "data/telemetry_math.h"
+#include "data/telemetry_resampler.h"
+
+namespace
+{
+  using gcs::data::SimdLevel;
+  using gcs::data::TelemetryData;
+  using gcs::data::TelemetryResampler;
+  using namespace gcs::benchmarks;
+
+  constexpr std::size_t kFrames = 1 << 16;
+
+  // A jittery stream with a slowly turning attitude.
+  std::vector<TelemetryData> MakeStream(std::uint64_t interval_us)
+  {
+    std::vector<TelemetryData> frames(kFrames);
+    for (std::size_t i = 0; i < kFrames; ++i)
+    {
+      const double x = static_cast<double>(i);
+      TelemetryData &frame = frames[i];
+      frame.timestamp_us = i * interval_us + (i * 7919) % (interval_us / 4);
+      frame.pos.data = {std::sin(0.01 * x), std::cos(0.01 * x), x};
+      frame.vel.data = {1.0, 2.0, 3.0};
+      frame.acc.data = {0.0, 0.0, -9.8};
+      frame.euler.data = {0.0, 0.0, 0.001 * x};
+      frame.quat.data = {std::cos(0.0005 * x), 0.0, 0.0, std::sin(0.0005 * x)};
+      frame.fsm = static_cast<std::uint8_t>(i / 1000);
+    }
+    return frames;
+  }
+
+  const char *LevelName(SimdLevel level)
+  {
+    switch (level)
+    {
+    case SimdLevel::kAvx2:
+      return "avx2";
+    case SimdLevel::kSse4:
+      return "sse4";
+    case SimdLevel::kScalar:
+      break;
+    }
+    return "scalar";
+  }
+
+  void Run(const char *name, const std::vector<TelemetryData> &input)
+  {
+    TelemetryResampler resampler;
+    std::vector<TelemetryData> out;
+    const double ns = MeasureNsPerItem(input.size(), [&]()
+                                       {
+                                         resampler.Reset();
+                                         out.clear();
+                                         resampler.Process(input, out);
+                                         Consume(out.back().timestamp_us); });
+    const std::string label =
+        std::string(name) + " (" + LevelName(gcs::data::GetSimdLevel()) + ")";
+    Report(label.c_str(), ns, "frame");
+  }
+} // namespace
+
+int main()
+{
+  // 1 kHz input resampled to 100 Hz, and 50 Hz input to 100 Hz.
+  const std::vector<TelemetryData> fast = MakeStream(1000);
+  const std::vector<TelemetryData> slow = MakeStream(20000);
+
+  const SimdLevel supported = gcs::data::GetSupportedSimdLevel();
+  for (SimdLevel level : {SimdLevel::kScalar, SimdLevel::kSse4,
+                          SimdLevel::kAvx2})
+  {
+    if (level > supported)
+      break;
+    gcs::data::SetSimdLevel(level);
+    Run("resample 1 kHz -> 100 Hz", fast);
+    Run("resample 50 Hz -> 100 Hz", slow);
+  }
+  return 0;
+}
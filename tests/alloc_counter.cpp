@@ -0,0 +1,77 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "alloc_counter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+  thread_local std::uint64_t tls_allocations = 0;
+
+  void *CountedAlloc(std::size_t size)
+  {
+    ++tls_allocations;
+    if (void *p = std::malloc(size ? size : 1))
+      return p;
+    throw std::bad_alloc();
+  }
+
+  void *CountedAlignedAlloc(std::size_t size, std::align_val_t align)
+  {
+    ++tls_allocations;
+    auto alignment = static_cast<std::size_t>(align);
+#ifdef _MSC_VER
+    void *p = _aligned_malloc(size ? size : 1, alignment);
+#else
+    // aligned_alloc requires the size to be a multiple of the alignment.
+    std::size_t rounded = (size + alignment - 1) / alignment * alignment;
+    void *p = std::aligned_alloc(alignment, rounded ? rounded : alignment);
+#endif
+    if (p)
+      return p;
+    throw std::bad_alloc();
+  }
+
+  void AlignedFree(void *p) noexcept
+  {
+#ifdef _MSC_VER
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+  }
+} // namespace
+
+namespace gcs::testing
+{
+  std::uint64_t GetThreadAllocationCount() { return tls_allocations; }
+} // namespace gcs::testing
+
+// Every replaceable allocation function funnels into the counters above.
+void *operator new(std::size_t size) { return CountedAlloc(size); }
+void *operator new[](std::size_t size) { return CountedAlloc(size); }
+void *operator new(std::size_t size, std::align_val_t align)
+{
+  return CountedAlignedAlloc(size, align);
+}
+void *operator new[](std::size_t size, std::align_val_t align)
+{
+  return CountedAlignedAlloc(size, align);
+}
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+void operator delete(void *p, std::align_val_t) noexcept { AlignedFree(p); }
+void operator delete[](void *p, std::align_val_t) noexcept { AlignedFree(p); }
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept
+{
+  AlignedFree(p);
+}
+void operator delete[](void *p, std::size_t, std::align_val_t) noexcept
+{
+  AlignedFree(p);
+}
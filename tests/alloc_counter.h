@@ -0,0 +1,40 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_TESTS_ALLOC_COUNTER_H_
+#define GCS_CORE_TESTS_ALLOC_COUNTER_H_
+
+#include <cstdint>
+
+namespace gcs::testing
+{
+
+  /**
+   * @brief Number of global operator new calls made by the current thread
+   * since it started.
+   */
+  std::uint64_t GetThreadAllocationCount();
+
+  /**
+   * @class AllocationScope
+   * @brief Counts the heap allocations the current thread makes while the
+   * scope is alive.
+   */
+  class AllocationScope
+  {
+  public:
+    AllocationScope() : start_(GetThreadAllocationCount()) {}
+
+    /**
+     * @brief Allocations made since the scope was entered.
+     */
+    std::uint64_t GetCount() const { return GetThreadAllocationCount() - start_; }
+
+  private:
+    std::uint64_t start_;
+  };
+
+} // namespace gcs::testing
+
+#endif // GCS_CORE_TESTS_ALLOC_COUNTER_H_
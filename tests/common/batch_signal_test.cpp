@@ -0,0 +1,126 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "common/event.h"
+
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "test_framework.h"
+
+namespace gcs::common
+{
+  namespace
+  {
+    GCS_TEST(BatchSignalTest, BatchListenersGetWholeRunBeforeItemListeners)
+    {
+      BatchSignal<int> signal;
+      std::vector<std::string> log;
+      auto item = signal.Connect([&log](const int &v)
+                                 { log.push_back("item " + std::to_string(v)); });
+      auto batch = signal.ConnectBatch([&log](std::span<const int> run)
+                                       { log.push_back("batch " + std::to_string(run.size())); });
+
+      const int values[] = {1, 2, 3};
+      signal.InvokeBatch(values);
+      GCS_EXPECT_EQ(log, (std::vector<std::string>{"batch 3", "item 1", "item 2",
+                                                   "item 3"}));
+    }
+
+    GCS_TEST(BatchSignalTest, InvokeIsARunOfOne)
+    {
+      BatchSignal<int> signal;
+      std::vector<std::vector<int>> runs;
+      auto batch = signal.ConnectBatch([&runs](std::span<const int> run)
+                                       { runs.emplace_back(run.begin(), run.end()); });
+
+      signal.Invoke(7);
+      signal.InvokeBatch(std::span<const int>{});
+      GCS_EXPECT_EQ(runs, (std::vector<std::vector<int>>{{7}}));
+    }
+
+    GCS_TEST(BatchSignalTest, ListenersKeepPriorityWithinTheirKind)
+    {
+      BatchSignal<int> signal;
+      std::vector<int> order;
+      auto low = signal.ConnectBatch([&order](std::span<const int>)
+                                     { order.push_back(0); });
+      auto high = signal.ConnectBatch([&order](std::span<const int>)
+                                      { order.push_back(1); },
+                                      {.name = "high", .priority = 5});
+      auto item = signal.Connect([&order](const int &)
+                                 { order.push_back(2); },
+                                 {.name = "item", .priority = 100});
+
+      signal.Invoke(0);
+      GCS_EXPECT_EQ(order, (std::vector<int>{1, 0, 2}));
+    }
+
+    GCS_TEST(BatchSignalTest, DisconnectedListenersAreNotCalled)
+    {
+      BatchSignal<int> signal;
+      int batches = 0;
+      int items = 0;
+      auto batch = signal.ConnectBatch([&batches](std::span<const int>)
+                                       { ++batches; });
+      auto item = signal.Connect([&items](const int &)
+                                 { ++items; });
+
+      const int values[] = {1, 2};
+      signal.InvokeBatch(values);
+      batch.reset();
+      signal.InvokeBatch(values);
+      item.reset();
+      signal.InvokeBatch(values);
+      GCS_EXPECT_EQ(batches, 1);
+      GCS_EXPECT_EQ(items, 4);
+    }
+
+    GCS_TEST(BatchSignalTest, ParallelItemListenersSeeRunInOrder)
+    {
+      auto pool = std::make_shared<ThreadPoolExecutor>(2);
+      BatchSignal<int> signal;
+      signal.SetDispatchMode(DispatchMode::kParallel, pool);
+
+      std::vector<int> first;
+      std::vector<int> second;
+      std::vector<int> batch_sizes;
+      auto a = signal.Connect([&first](const int &v)
+                              { first.push_back(v); });
+      auto b = signal.Connect([&second](const int &v)
+                              { second.push_back(v); });
+      auto batch = signal.ConnectBatch([&batch_sizes](std::span<const int> run)
+                                       { batch_sizes.push_back(static_cast<int>(run.size())); });
+
+      std::vector<int> values(100);
+      for (int i = 0; i < 100; ++i)
+        values[static_cast<std::size_t>(i)] = i;
+      signal.InvokeBatch(values);
+      signal.InvokeBatch(std::span<const int>(values).first(10));
+
+      std::vector<int> expected = values;
+      expected.insert(expected.end(), values.begin(), values.begin() + 10);
+      GCS_EXPECT_EQ(first, expected);
+      GCS_EXPECT_EQ(second, expected);
+      GCS_EXPECT_EQ(batch_sizes, (std::vector<int>{100, 10}));
+    }
+
+    GCS_TEST(BatchSignalTest, ListenerStatsListBatchListenersFirst)
+    {
+      BatchSignal<int> signal;
+      auto item = signal.Connect([](const int &) {},
+                                 {.name = "item", .priority = 0});
+      auto batch = signal.ConnectBatch([](std::span<const int>) {},
+                                       {.name = "batch", .priority = 0});
+
+      std::vector<ListenerStats> stats = signal.GetListenerStats();
+      GCS_ASSERT_EQ(stats.size(), 2u);
+      GCS_EXPECT_EQ(stats[0].name, std::string("batch"));
+      GCS_EXPECT_EQ(stats[1].name, std::string("item"));
+    }
+
+  } // namespace
+} // namespace gcs::common
@@ -0,0 +1,157 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "common/block_pool.h"
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "alloc_counter.h"
+#include "test_framework.h"
+
+namespace gcs::common
+{
+  namespace
+  {
+    using testing::AllocationScope;
+
+    GCS_TEST(BlockPoolTest, FreedBlockIsReused)
+    {
+      BlockPool pool;
+      void *first = pool.Allocate(32, alignof(std::max_align_t));
+      pool.Deallocate(first, 32, alignof(std::max_align_t));
+      GCS_EXPECT_EQ(pool.GetFreeCount(), 1u);
+
+      AllocationScope scope;
+      void *second = pool.Allocate(32, alignof(std::max_align_t));
+      GCS_EXPECT_EQ(second, first);
+      GCS_EXPECT_EQ(scope.GetCount(), 0u);
+      GCS_EXPECT_EQ(pool.GetHeapAllocationCount(), 1u);
+      pool.Deallocate(second, 32, alignof(std::max_align_t));
+    }
+
+    GCS_TEST(BlockPoolTest, SteadyStateStopsAtPeak)
+    {
+      BlockPool pool;
+      std::vector<void *> live;
+      for (int round = 0; round < 10; ++round)
+      {
+        for (int i = 0; i < 8; ++i)
+        {
+          live.push_back(pool.Allocate(24, alignof(std::uint64_t)));
+        }
+        for (void *block : live)
+        {
+          pool.Deallocate(block, 24, alignof(std::uint64_t));
+        }
+        live.clear();
+      }
+      GCS_EXPECT_EQ(pool.GetHeapAllocationCount(), 8u);
+      GCS_EXPECT_EQ(pool.GetFreeCount(), 8u);
+    }
+
+    GCS_TEST(BlockPoolTest, FreeListIsCapped)
+    {
+      BlockPool pool(2);
+      std::vector<void *> blocks;
+      for (int i = 0; i < 5; ++i)
+      {
+        blocks.push_back(pool.Allocate(16, alignof(std::uint64_t)));
+      }
+      for (void *block : blocks)
+      {
+        pool.Deallocate(block, 16, alignof(std::uint64_t));
+      }
+      GCS_EXPECT_EQ(pool.GetFreeCount(), 2u);
+
+      // Two blocks come back from the free list, the rest from the heap.
+      blocks.clear();
+      for (int i = 0; i < 5; ++i)
+      {
+        blocks.push_back(pool.Allocate(16, alignof(std::uint64_t)));
+      }
+      GCS_EXPECT_EQ(pool.GetHeapAllocationCount(), 8u);
+      for (void *block : blocks)
+      {
+        pool.Deallocate(block, 16, alignof(std::uint64_t));
+      }
+    }
+
+    GCS_TEST(BlockPoolTest, DefaultCapMatchesConfig)
+    {
+      BlockPool pool;
+      std::vector<void *> blocks(kPacketPoolMaxFreeBlocks + 3);
+      for (void *&block : blocks)
+      {
+        block = pool.Allocate(16, alignof(std::uint64_t));
+      }
+      for (void *block : blocks)
+      {
+        pool.Deallocate(block, 16, alignof(std::uint64_t));
+      }
+      GCS_EXPECT_EQ(pool.GetFreeCount(), kPacketPoolMaxFreeBlocks);
+    }
+
+    GCS_TEST(BlockPoolTest, FirstAllocationFixesBlockSize)
+    {
+      BlockPool pool;
+      void *block = pool.Allocate(48, alignof(std::max_align_t));
+      pool.Deallocate(block, 48, alignof(std::max_align_t));
+
+      // Smaller requests fit the 48-byte block and are pooled.
+      AllocationScope smaller;
+      void *small = pool.Allocate(8, alignof(std::uint64_t));
+      GCS_EXPECT_EQ(small, block);
+      GCS_EXPECT_EQ(smaller.GetCount(), 0u);
+      pool.Deallocate(small, 8, alignof(std::uint64_t));
+
+      // Larger requests bypass the pool on both ends.
+      AllocationScope larger;
+      void *large = pool.Allocate(64, alignof(std::max_align_t));
+      GCS_EXPECT_EQ(larger.GetCount(), 1u);
+      GCS_EXPECT_EQ(pool.GetHeapAllocationCount(), 1u);
+      pool.Deallocate(large, 64, alignof(std::max_align_t));
+      GCS_EXPECT_EQ(pool.GetFreeCount(), 1u);
+    }
+
+    GCS_TEST(BlockPoolTest, ExtendedAlignmentBypassesPool)
+    {
+      BlockPool pool;
+      constexpr std::size_t kAlignment = 2 * __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+      void *block = pool.Allocate(kAlignment, kAlignment);
+      GCS_EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block) % kAlignment, 0u);
+      pool.Deallocate(block, kAlignment, kAlignment);
+      GCS_EXPECT_EQ(pool.GetFreeCount(), 0u);
+      GCS_EXPECT_EQ(pool.GetHeapAllocationCount(), 0u);
+    }
+
+    GCS_TEST(PoolAllocatorTest, AllocateSharedReusesControlBlock)
+    {
+      BlockPool pool;
+      PoolAllocator<int> allocator(pool);
+      std::allocate_shared<int>(allocator, 1).reset();
+
+      AllocationScope scope;
+      for (int i = 0; i < 100; ++i)
+      {
+        auto value = std::allocate_shared<int>(allocator, i);
+        GCS_EXPECT_EQ(*value, i);
+      }
+      GCS_EXPECT_EQ(scope.GetCount(), 0u);
+      GCS_EXPECT_EQ(pool.GetHeapAllocationCount(), 1u);
+    }
+
+    GCS_TEST(PoolAllocatorTest, RebindsToSamePool)
+    {
+      BlockPool pool;
+      PoolAllocator<int> ints(pool);
+      PoolAllocator<double> doubles(ints);
+      GCS_EXPECT_TRUE(ints == doubles);
+      GCS_EXPECT_EQ(doubles.GetPool(), &pool);
+    }
+
+  } // namespace
+} // namespace gcs::common
@@ -0,0 +1,126 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "common/event.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "test_framework.h"
+
+namespace gcs::common
+{
+  namespace
+  {
+    using namespace std::chrono_literals;
+
+    GCS_TEST(ConflatingSignalTest, TryReadReturnsOnlyNewerValues)
+    {
+      ConflatingSignal<int> signal;
+      int value = 0;
+      std::uint64_t seen = 0;
+      GCS_EXPECT_FALSE(signal.TryRead(value, seen));
+
+      signal.Publish(1);
+      signal.Publish(2);
+      GCS_EXPECT_TRUE(signal.TryRead(value, seen));
+      GCS_EXPECT_EQ(value, 2);
+      GCS_EXPECT_FALSE(signal.TryRead(value, seen));
+    }
+
+    GCS_TEST(ConflatingSignalTest, ConsumersShareOneThread)
+    {
+      ConflatingSignal<int> signal;
+      std::mutex mutex;
+      std::set<std::thread::id> threads;
+      std::atomic<int> calls = 0;
+      std::vector<SignalToken> tokens;
+      for (int i = 0; i < 8; ++i)
+      {
+        tokens.push_back(signal.Connect([&](const int &)
+                                        {
+                                          std::lock_guard<std::mutex> lock(mutex);
+                                          threads.insert(std::this_thread::get_id());
+                                          ++calls; },
+                                        200.0));
+      }
+
+      signal.Publish(1);
+      auto deadline = std::chrono::steady_clock::now() + 5s;
+      while (calls.load() < 8 && std::chrono::steady_clock::now() < deadline)
+      {
+        std::this_thread::sleep_for(1ms);
+      }
+      tokens.clear();
+
+      GCS_EXPECT_EQ(calls.load(), 8); // One call each: the value never changed.
+      GCS_EXPECT_EQ(threads.size(), 1u);
+    }
+
+    GCS_TEST(ConflatingSignalTest, RateIsLimited)
+    {
+      ConflatingSignal<int> signal;
+      std::atomic<int> calls = 0;
+      auto token = signal.Connect([&calls](const int &)
+                                  { ++calls; },
+                                  20.0);
+
+      auto end = std::chrono::steady_clock::now() + 250ms;
+      for (int i = 1; std::chrono::steady_clock::now() < end; ++i)
+      {
+        signal.Publish(i);
+        std::this_thread::sleep_for(100us);
+      }
+      token.reset();
+
+      // About five ticks fit into 250 ms.
+      GCS_EXPECT_GE(calls.load(), 1);
+      GCS_EXPECT_LE(calls.load(), 7);
+    }
+
+    GCS_TEST(ConflatingSignalTest, TokenMayOutliveSignal)
+    {
+      SignalToken token;
+      {
+        ConflatingSignal<int> signal;
+        token = signal.Connect([](const int &) {}, 100.0);
+        signal.Publish(1);
+        std::this_thread::sleep_for(20ms);
+      }
+      token.reset();
+      GCS_EXPECT_FALSE(token);
+    }
+
+    GCS_TEST(ConflatingSignalTest, CallbackCanDisconnectItself)
+    {
+      ConflatingSignal<int> signal;
+      std::atomic<int> calls = 0;
+      SignalToken token;
+      std::mutex mutex;
+      {
+        // Held so the callback cannot run before the token is assigned.
+        std::lock_guard<std::mutex> lock(mutex);
+        token = signal.Connect([&](const int &)
+                               {
+                                 std::lock_guard<std::mutex> lock(mutex);
+                                 ++calls;
+                                 token.reset(); },
+                               500.0);
+      }
+
+      for (int i = 1; i <= 50; ++i)
+      {
+        signal.Publish(i);
+        std::this_thread::sleep_for(1ms);
+      }
+      GCS_EXPECT_EQ(calls.load(), 1);
+    }
+
+  } // namespace
+} // namespace gcs::common
@@ -0,0 +1,112 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "common/delegate.h"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "alloc_counter.h"
+#include "test_framework.h"
+
+namespace gcs::common
+{
+  namespace
+  {
+    using testing::AllocationScope;
+
+    struct CopyCounter
+    {
+      CopyCounter() = default;
+      CopyCounter(const CopyCounter &other) : copies(other.copies) { ++*copies; }
+      CopyCounter &operator=(const CopyCounter &) = default;
+
+      std::shared_ptr<int> copies = std::make_shared<int>(0);
+    };
+
+    int AddOne(int value) { return value + 1; }
+
+    GCS_TEST(DelegateTest, SmallTargetIsStoredInline)
+    {
+      int a = 1, b = 2, c = 3;
+      AllocationScope scope;
+      Delegate<int(int)> delegate([&a, &b, &c](int x)
+                                  { return a + b + c + x; });
+      Delegate<int(int)> moved = std::move(delegate);
+      GCS_EXPECT_EQ(moved(4), 10);
+      GCS_EXPECT_FALSE(delegate);
+      GCS_EXPECT_EQ(scope.GetCount(), 0u);
+    }
+
+    GCS_TEST(DelegateTest, InlineCapacityMatchesConfig)
+    {
+      using Capture = std::array<void *, kDelegateInlineSize / sizeof(void *)>;
+      using Oversized = std::array<void *, kDelegateInlineSize / sizeof(void *) + 1>;
+      auto fits = [capture = Capture{}]() {};
+      auto spills = [capture = Oversized{}]() {};
+      GCS_EXPECT_TRUE(Delegate<void()>::kStoresInline<decltype(fits)>);
+      GCS_EXPECT_FALSE(Delegate<void()>::kStoresInline<decltype(spills)>);
+    }
+
+    GCS_TEST(DelegateTest, LargeTargetAllocatesOnceAndMovesWithoutAllocating)
+    {
+      std::array<int, 32> table{};
+      table[5] = 7;
+
+      AllocationScope construct;
+      Delegate<int(int)> delegate([table](int i)
+                                  { return table[static_cast<std::size_t>(i)]; });
+      GCS_EXPECT_EQ(construct.GetCount(), 1u);
+
+      AllocationScope use;
+      Delegate<int(int)> moved = std::move(delegate);
+      GCS_EXPECT_EQ(moved(5), 7);
+      GCS_EXPECT_EQ(use.GetCount(), 0u);
+    }
+
+    GCS_TEST(DelegateTest, FunctionPointer)
+    {
+      Delegate<int(int)> delegate(&AddOne);
+      GCS_EXPECT_EQ(delegate(1), 2);
+
+      int (*null_function)(int) = nullptr;
+      GCS_EXPECT_FALSE(Delegate<int(int)>(null_function));
+    }
+
+    GCS_TEST(DelegateTest, ResetDestroysTarget)
+    {
+      auto owned = std::make_shared<int>(0);
+      Delegate<void()> delegate([owned]() {});
+      GCS_EXPECT_EQ(owned.use_count(), 2);
+      delegate = nullptr;
+      GCS_EXPECT_EQ(owned.use_count(), 1);
+    }
+
+    GCS_TEST(DelegateTest, InvokeViewPassesConstReferenceWithoutCopy)
+    {
+      CopyCounter value;
+      Delegate<void(CopyCounter)> by_ref([](const CopyCounter &) {});
+      by_ref.InvokeView(value);
+      GCS_EXPECT_EQ(*value.copies, 0);
+
+      // A target taking its parameter by value still receives one copy.
+      Delegate<void(CopyCounter)> by_value([](CopyCounter) {});
+      by_value.InvokeView(value);
+      GCS_EXPECT_EQ(*value.copies, 1);
+    }
+
+    GCS_TEST(DelegateTest, InvokeSinkMovesIntoTarget)
+    {
+      std::string received;
+      Delegate<void(std::string)> delegate([&received](std::string s)
+                                           { received = std::move(s); });
+      std::string text(64, 'x');
+      delegate.InvokeSink(std::move(text));
+      GCS_EXPECT_EQ(received.size(), 64u);
+    }
+
+  } // namespace
+} // namespace gcs::common
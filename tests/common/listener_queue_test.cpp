@@ -0,0 +1,134 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "common/event.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "test_framework.h"
+
+namespace gcs::common
+{
+  namespace
+  {
+    using namespace std::chrono_literals;
+
+    GCS_TEST(ListenerQueueTest, DropOldestKeepsNewestEvents)
+    {
+      auto executor = std::make_shared<ManualExecutor>();
+      Signal<int> signal;
+      std::vector<int> seen;
+      auto token = signal.ConnectQueued([&seen](int v)
+                                        { seen.push_back(v); },
+                                        {.executor = executor,
+                                         .capacity = 2,
+                                         .overflow = OverflowPolicy::kDropOldest});
+      for (int i = 0; i < 5; ++i)
+      {
+        signal.Invoke(i);
+      }
+      GCS_EXPECT_EQ(token->GetQueueDepth(), 2u);
+      executor->RunPending();
+      GCS_EXPECT_EQ(seen, (std::vector<int>{3, 4}));
+      GCS_EXPECT_EQ(token->GetDroppedCount(), 3u);
+      GCS_EXPECT_EQ(token->GetDeliveredCount(), 2u);
+    }
+
+    GCS_TEST(ListenerQueueTest, BlockWaitsForListenerOnAnotherThread)
+    {
+      auto executor = std::make_shared<DedicatedThreadExecutor>();
+      Signal<int> signal;
+      std::atomic<int> sum = 0;
+      auto token = signal.ConnectQueued([&sum](int v)
+                                        {
+                                          std::this_thread::sleep_for(100us);
+                                          sum += v; },
+                                        {.executor = executor,
+                                         .capacity = 2,
+                                         .overflow = OverflowPolicy::kBlock});
+      for (int i = 0; i < 50; ++i)
+      {
+        signal.Invoke(1);
+      }
+      while (token->GetDeliveredCount() < 50)
+      {
+        std::this_thread::sleep_for(1ms);
+      }
+      GCS_EXPECT_EQ(sum.load(), 50);
+      GCS_EXPECT_EQ(token->GetDroppedCount(), 0u);
+    }
+
+    GCS_TEST(ListenerQueueTest, BlockDoesNotWaitOnThreadPumpingManualExecutor)
+    {
+      auto executor = std::make_shared<ManualExecutor>();
+      executor->RunPending(); // This thread now pumps the executor.
+
+      Signal<int> signal;
+      std::vector<int> seen;
+      auto token = signal.ConnectQueued([&seen](int v)
+                                        { seen.push_back(v); },
+                                        {.executor = executor,
+                                         .capacity = 1,
+                                         .overflow = OverflowPolicy::kBlock});
+      signal.Invoke(1);
+      signal.Invoke(2);
+      executor->RunPending();
+      GCS_EXPECT_EQ(seen, (std::vector<int>{1}));
+      GCS_EXPECT_EQ(token->GetDroppedCount(), 1u);
+    }
+
+    GCS_TEST(ListenerQueueTest, BlockDoesNotWaitOnSingleWorkerProducer)
+    {
+      auto executor = std::make_shared<DedicatedThreadExecutor>();
+      Signal<int> signal;
+      std::atomic<int> delivered = 0;
+      auto token = signal.ConnectQueued([&delivered](int)
+                                        { ++delivered; },
+                                        {.executor = executor,
+                                         .capacity = 1,
+                                         .overflow = OverflowPolicy::kBlock});
+
+      // The producer runs as a task on the listener's only worker.
+      std::promise<void> produced;
+      executor->Post([&signal, &produced]()
+                     {
+                       signal.Invoke(1);
+                       signal.Invoke(2);
+                       produced.set_value(); });
+      auto future = produced.get_future();
+      GCS_ASSERT_TRUE(future.wait_for(5s) == std::future_status::ready);
+
+      while (delivered.load() < 1)
+      {
+        std::this_thread::sleep_for(1ms);
+      }
+      GCS_EXPECT_EQ(token->GetDroppedCount(), 1u);
+    }
+
+    GCS_TEST(ListenerQueueTest, SelfDisconnectMayReleaseLastExecutorReference)
+    {
+      // The queue holds the only reference to the pool, so the listener's
+      // own disconnect drops it on a pool worker.
+      Signal<int> signal;
+      std::unique_ptr<QueuedConnection> token;
+      auto disconnected = std::make_shared<std::promise<void>>();
+      token = signal.ConnectQueued([&token, disconnected](int)
+                                   {
+                                     token.reset();
+                                     disconnected->set_value(); },
+                                   {.executor = std::make_shared<ThreadPoolExecutor>(2)});
+      auto future = disconnected->get_future();
+      signal.Invoke(1);
+
+      GCS_ASSERT_TRUE(future.wait_for(5s) == std::future_status::ready);
+      GCS_EXPECT_TRUE(token == nullptr);
+    }
+
+  } // namespace
+} // namespace gcs::common
@@ -0,0 +1,175 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "common/event.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <semaphore>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "test_framework.h"
+
+namespace gcs::common
+{
+  namespace
+  {
+    using namespace std::chrono_literals;
+
+    GCS_TEST(SignalParallelTest, InvokeWaitsForAllListeners)
+    {
+      auto pool = std::make_shared<ThreadPoolExecutor>(4);
+      Signal<int> signal;
+      signal.SetDispatchMode(DispatchMode::kParallel, pool);
+
+      std::atomic<int> sum = 0;
+      std::vector<SignalToken> tokens;
+      for (int i = 0; i < 8; ++i)
+      {
+        tokens.push_back(signal.Connect([&sum](int v)
+                                        {
+                                          std::this_thread::sleep_for(1ms);
+                                          sum += v; }));
+      }
+
+      for (int i = 0; i < 10; ++i)
+      {
+        signal.Invoke(1);
+        GCS_EXPECT_EQ(sum.load(), 8 * (i + 1));
+      }
+    }
+
+    GCS_TEST(SignalParallelTest, InvokeRethrowsListenerException)
+    {
+      auto pool = std::make_shared<ThreadPoolExecutor>(2);
+      Signal<int> signal;
+      signal.SetDispatchMode(DispatchMode::kParallel, pool);
+
+      std::atomic<int> calls = 0;
+      auto ok = signal.Connect([&calls](int)
+                               { ++calls; });
+      auto bad = signal.Connect([](int)
+                                { throw std::runtime_error("listener"); });
+
+      bool thrown = false;
+      try
+      {
+        signal.Invoke(1);
+      }
+      catch (const std::runtime_error &)
+      {
+        thrown = true;
+      }
+      GCS_EXPECT_TRUE(thrown);
+      GCS_EXPECT_EQ(calls.load(), 1);
+    }
+
+    GCS_TEST(SignalParallelTest, InvokeDoesNotRunUnrelatedPoolTasks)
+    {
+      // The only worker is busy and an unrelated task that waits for this
+      // test is queued ahead of the batch. The invoker must run its own
+      // listeners instead of picking up the unrelated task.
+      auto pool = std::make_shared<ThreadPoolExecutor>(1);
+      std::binary_semaphore release(0);
+      std::binary_semaphore worker_busy(0);
+      pool->Post([&]()
+                 {
+                   worker_busy.release();
+                   release.acquire(); });
+      worker_busy.acquire();
+      std::atomic<bool> unrelated_ran = false;
+      pool->Post([&unrelated_ran]()
+                 { unrelated_ran = true; });
+
+      Signal<int> signal;
+      signal.SetDispatchMode(DispatchMode::kParallel, pool);
+      std::atomic<int> calls = 0;
+      auto a = signal.Connect([&calls](int)
+                              { ++calls; });
+      auto b = signal.Connect([&calls](int)
+                              { ++calls; });
+
+      auto invoked = std::async(std::launch::async, [&signal]()
+                                { signal.Invoke(1); });
+      bool finished = invoked.wait_for(5s) == std::future_status::ready;
+      GCS_EXPECT_TRUE(finished);
+      GCS_EXPECT_EQ(calls.load(), 2);
+      GCS_EXPECT_FALSE(unrelated_ran.load());
+
+      release.release();
+      invoked.wait();
+    }
+
+    GCS_TEST(SignalParallelTest, DisconnectWaitsForRunningCall)
+    {
+      auto pool = std::make_shared<ThreadPoolExecutor>(2);
+      Signal<int> signal;
+      signal.SetDispatchMode(DispatchMode::kParallelDetached, pool);
+
+      std::binary_semaphore entered(0);
+      std::binary_semaphore release(0);
+      std::atomic<bool> returned = false;
+      auto token = signal.Connect([&](int)
+                                  {
+                                    entered.release();
+                                    release.acquire();
+                                    returned = true; });
+      signal.Invoke(1);
+      entered.acquire();
+
+      auto disconnected = std::async(std::launch::async, [&token]()
+                                     { token.reset(); });
+      GCS_EXPECT_TRUE(disconnected.wait_for(50ms) == std::future_status::timeout);
+
+      release.release();
+      disconnected.wait();
+      GCS_EXPECT_TRUE(returned.load());
+    }
+
+    GCS_TEST(SignalParallelTest, ListenerCanDisconnectItself)
+    {
+      auto pool = std::make_shared<ThreadPoolExecutor>(2);
+      Signal<int> signal;
+      signal.SetDispatchMode(DispatchMode::kParallel, pool);
+
+      SignalToken token;
+      std::atomic<int> calls = 0;
+      token = signal.Connect([&token, &calls](int)
+                             {
+                               ++calls;
+                               token.reset(); });
+      auto other = signal.Connect([](int) {});
+
+      signal.Invoke(1);
+      signal.Invoke(2);
+      GCS_EXPECT_EQ(calls.load(), 1);
+    }
+
+    GCS_TEST(SignalParallelTest, DestroyingSignalWithPendingBatchesIsSafe)
+    {
+      auto pool = std::make_shared<ThreadPoolExecutor>(2);
+      std::atomic<int> calls = 0;
+      {
+        Signal<int> signal;
+        signal.SetDispatchMode(DispatchMode::kParallelDetached, pool);
+        {
+          auto token = signal.Connect([&calls](int)
+                                      {
+                                        std::this_thread::sleep_for(1ms);
+                                        ++calls; });
+          for (int i = 0; i < 20; ++i)
+          {
+            signal.Invoke(i);
+          }
+        }
+      }
+      GCS_EXPECT_LE(calls.load(), 20);
+    }
+
+  } // namespace
+} // namespace gcs::common
@@ -0,0 +1,108 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "common/event.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "test_framework.h"
+
+namespace gcs::common
+{
+  namespace
+  {
+    using namespace std::chrono_literals;
+
+    std::uint64_t HistogramTotal(const ListenerStats &stats)
+    {
+      return std::accumulate(stats.latency_counts.begin(),
+                             stats.latency_counts.end(), std::uint64_t{0});
+    }
+
+    GCS_TEST(SignalStatsTest, StatsFollowConnectedListeners)
+    {
+      Signal<int> signal;
+      auto fast = signal.Connect([](int) {}, {.name = "fast", .priority = 1});
+      auto gone = signal.Connect([](int) {}, {.name = "gone", .priority = 0});
+      gone.reset();
+
+      std::vector<ListenerStats> stats = signal.GetListenerStats();
+      GCS_ASSERT_EQ(stats.size(), 1u);
+      GCS_EXPECT_EQ(stats[0].name, std::string("fast"));
+      GCS_EXPECT_EQ(stats[0].priority, 1);
+    }
+
+    GCS_TEST(SignalStatsTest, CountsCallsAndTimePerListener)
+    {
+      Signal<int> signal;
+      auto fast = signal.Connect([](int) {}, {.name = "fast", .priority = 1});
+      auto slow = signal.Connect([](int)
+                                 { std::this_thread::sleep_for(2ms); },
+                                 {.name = "slow", .priority = 0});
+      for (int i = 0; i < 5; ++i)
+        signal.Invoke(i);
+
+      std::vector<ListenerStats> stats = signal.GetListenerStats();
+      GCS_ASSERT_EQ(stats.size(), 2u);
+      const ListenerStats &fast_stats = stats[0].name == "fast" ? stats[0] : stats[1];
+      const ListenerStats &slow_stats = stats[0].name == "slow" ? stats[0] : stats[1];
+#if GCS_SIGNAL_STATS
+      GCS_EXPECT_EQ(fast_stats.call_count, 5u);
+      GCS_EXPECT_EQ(slow_stats.call_count, 5u);
+      GCS_EXPECT_EQ(HistogramTotal(fast_stats), 5u);
+      GCS_EXPECT_EQ(HistogramTotal(slow_stats), 5u);
+      GCS_EXPECT_GE(slow_stats.total_time, std::chrono::nanoseconds(10ms));
+      GCS_EXPECT_LT(fast_stats.total_time, slow_stats.total_time);
+
+      // Every slow call lands in a bucket starting at 1 ms or more.
+      std::uint64_t slow_calls = 0;
+      for (std::size_t i = 0; i < LatencyHistogram::kBucketCount; ++i)
+      {
+        if (LatencyHistogram::BucketLowerBound(i) >= 1'000'000)
+          slow_calls += slow_stats.latency_counts[i];
+      }
+      GCS_EXPECT_EQ(slow_calls, 5u);
+#else
+      // Built without instrumentation: only names and priorities are filled.
+      for (const ListenerStats *entry : {&fast_stats, &slow_stats})
+      {
+        GCS_EXPECT_EQ(entry->call_count, 0u);
+        GCS_EXPECT_EQ(entry->total_time.count(), 0);
+        GCS_EXPECT_EQ(HistogramTotal(*entry), 0u);
+      }
+#endif
+    }
+
+    GCS_TEST(SignalStatsTest, ParallelAndBatchCallsAreCounted)
+    {
+      auto pool = std::make_shared<ThreadPoolExecutor>(2);
+      Signal<const int &> signal;
+      signal.SetDispatchMode(DispatchMode::kParallel, pool);
+      std::vector<SignalToken> tokens;
+      for (int i = 0; i < 4; ++i)
+      {
+        tokens.push_back(signal.Connect([](const int &) {},
+                                        {.name = "listener", .priority = 0}));
+      }
+
+      const int values[] = {1, 2, 3};
+      signal.Invoke(0);
+      signal.InvokeForEach(values);
+
+      const std::uint64_t expected = GCS_SIGNAL_STATS ? 4u : 0u;
+      for (const ListenerStats &entry : signal.GetListenerStats())
+      {
+        GCS_EXPECT_EQ(entry.call_count, expected);
+        GCS_EXPECT_EQ(HistogramTotal(entry), expected);
+      }
+    }
+
+  } // namespace
+} // namespace gcs::common
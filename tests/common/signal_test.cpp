@@ -0,0 +1,181 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "common/event.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <semaphore>
+#include <thread>
+#include <vector>
+
+#include "alloc_counter.h"
+#include "test_framework.h"
+
+namespace gcs::common
+{
+  namespace
+  {
+    using testing::AllocationScope;
+
+    struct Frame
+    {
+      double values[16];
+    };
+
+    GCS_TEST(SignalTest, InvokeCallsListenersInPriorityOrder)
+    {
+      Signal<int> signal;
+      std::vector<int> order;
+      auto low = signal.Connect([&order](int)
+                                { order.push_back(0); });
+      auto high = signal.Connect([&order](int)
+                                 { order.push_back(1); },
+                                 {.name = "", .priority = 10});
+      signal.Invoke(1);
+      GCS_EXPECT_EQ(order, (std::vector<int>{1, 0}));
+    }
+
+    GCS_TEST(SignalTest, DisconnectedListenerIsNotCalled)
+    {
+      Signal<int> signal;
+      int calls = 0;
+      auto token = signal.Connect([&calls](int)
+                                  { ++calls; });
+      signal.Invoke(1);
+      token.reset();
+      signal.Invoke(2);
+      GCS_EXPECT_EQ(calls, 1);
+    }
+
+    GCS_TEST(SignalTest, InvokeDoesNotAllocate)
+    {
+      Signal<const Frame &> signal;
+      double sum = 0.0;
+      std::vector<SignalToken> tokens;
+      for (int i = 0; i < 16; ++i)
+      {
+        tokens.push_back(signal.Connect([&sum](const Frame &frame)
+                                        { sum += frame.values[0]; },
+                                        {.name = "", .priority = i % 3}));
+      }
+
+      Frame frame{};
+      frame.values[0] = 1.0;
+      AllocationScope scope;
+      for (int i = 0; i < 1000; ++i)
+      {
+        signal.Invoke(frame);
+      }
+      GCS_EXPECT_EQ(scope.GetCount(), 0u);
+      GCS_EXPECT_EQ(sum, 16000.0);
+    }
+
+    GCS_TEST(SignalTest, InvokeWithCapturingListenersDoesNotAllocate)
+    {
+      // Six pointers of capture fit the Delegate's inline buffer.
+      Signal<int> signal;
+      std::array<int, 6> counters{};
+      int *a = &counters[0], *b = &counters[1], *c = &counters[2];
+      int *d = &counters[3], *e = &counters[4], *f = &counters[5];
+      auto token = signal.Connect([a, b, c, d, e, f](int v)
+                                  { *a += v; *b += v; *c += v;
+                                    *d += v; *e += v; *f += v; });
+
+      AllocationScope scope;
+      signal.Invoke(2);
+      GCS_EXPECT_EQ(scope.GetCount(), 0u);
+      GCS_EXPECT_EQ(counters[5], 2);
+    }
+
+    GCS_TEST(SignalTest, InvokePassesArgumentsWithoutCopying)
+    {
+      struct Counted
+      {
+        Counted() = default;
+        Counted(const Counted &other) : copies(other.copies + 1) {}
+        int copies = 0;
+      };
+
+      Signal<Counted> signal;
+      int seen_copies = -1;
+      auto token = signal.Connect([&seen_copies](const Counted &value)
+                                  { seen_copies = value.copies; });
+      Counted value;
+      signal.Invoke(static_cast<const Counted &>(value));
+      GCS_EXPECT_EQ(seen_copies, 0);
+    }
+
+    // Counts live copies of a listener's captured state, so tests can tell
+    // whether disconnected listeners have been reclaimed.
+    struct LiveProbe
+    {
+      static inline std::atomic<int> live = 0;
+
+      LiveProbe() { ++live; }
+      LiveProbe(const LiveProbe &) noexcept { ++live; }
+      LiveProbe(LiveProbe &&) noexcept { ++live; }
+      ~LiveProbe() { --live; }
+    };
+
+    GCS_TEST(SignalTest, ChurnUnderContinuousInvokeReclaimsListeners)
+    {
+      // Two invokers hand over in a relay so that an Invoke is in flight at
+      // every point of the churn: the next one enters before the current
+      // one is let go.
+      Signal<int> signal;
+      std::counting_semaphore<> entered[2]{std::counting_semaphore<>(0),
+                                           std::counting_semaphore<>(0)};
+      std::counting_semaphore<> gate[2]{std::counting_semaphore<>(0),
+                                        std::counting_semaphore<>(0)};
+      auto relay = signal.Connect([&entered, &gate](int id)
+                                  {
+                                    entered[id].release();
+                                    gate[id].acquire(); });
+
+      std::atomic<bool> stop = false;
+      std::vector<std::thread> invokers;
+      for (int id = 0; id < 2; ++id)
+      {
+        invokers.emplace_back([&signal, &stop, id]()
+                              {
+                                while (!stop.load())
+                                {
+                                  signal.Invoke(id);
+                                } });
+      }
+
+      constexpr int kRounds = 500;
+      int current = 0;
+      int peak = 0;
+      entered[current].acquire();
+      for (int i = 0; i < kRounds; ++i)
+      {
+        auto token = signal.Connect([probe = LiveProbe{}](int) {},
+                                    {.name = "", .priority = i % 5});
+        token.reset();
+        peak = std::max(peak, LiveProbe::live.load());
+
+        int next = 1 - current;
+        entered[next].acquire();
+        gate[current].release();
+        current = next;
+      }
+
+      stop = true;
+      gate[0].release();
+      gate[1].release();
+      for (auto &thread : invokers)
+      {
+        thread.join();
+      }
+
+      // Only the not-yet-compacted tail and one draining epoch may be held
+      // back; retired listeners must not accumulate with the churn.
+      GCS_EXPECT_LT(peak, 32);
+    }
+
+  } // namespace
+} // namespace gcs::common
@@ -0,0 +1,122 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "common/static_signal.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "alloc_counter.h"
+#include "common/event.h"
+#include "support/sample_protocol.h"
+#include "test_framework.h"
+
+namespace gcs::common
+{
+  namespace
+  {
+    using data::TelemetryData;
+    using testing::AllocationScope;
+    using testing::MakeSampleStream;
+    using testing::SampleConverter;
+    using testing::SampleParser;
+
+    // Feeds bytes in uneven chunks so frames straddle PushData calls.
+    template <typename Target>
+    void PushInChunks(Target &target, std::span<const std::uint8_t> bytes)
+    {
+      std::size_t chunk = 7;
+      for (std::size_t offset = 0; offset < bytes.size();)
+      {
+        std::size_t size = std::min(chunk, bytes.size() - offset);
+        target.PushData(bytes.subspan(offset, size));
+        offset += size;
+        chunk = chunk % 23 + 5;
+      }
+    }
+
+    GCS_TEST(StaticPipelineTest, DeliversEveryFrameToStaticAndDynamicSinks)
+    {
+      auto bytes = MakeSampleStream(100);
+      BatchSignal<TelemetryData> on_telemetry;
+      std::vector<std::uint64_t> dynamic_times;
+      auto token = on_telemetry.Connect([&dynamic_times](const TelemetryData &frame)
+                                        { dynamic_times.push_back(frame.timestamp_us); });
+
+      double altitude_sum = 0.0;
+      StaticPipeline pipeline(SampleParser{}, SampleConverter{},
+                              [&altitude_sum](const TelemetryData &frame)
+                              { altitude_sum += frame.pos.z(); },
+                              DynamicSink(on_telemetry));
+      PushInChunks(pipeline, bytes);
+
+      GCS_ASSERT_EQ(dynamic_times.size(), 100u);
+      GCS_EXPECT_EQ(dynamic_times[99], 990000u);
+      GCS_EXPECT_EQ(altitude_sum, 4950.0);
+    }
+
+    GCS_TEST(StaticPipelineTest, MatchesVirtualPipeline)
+    {
+      auto bytes = MakeSampleStream(50);
+
+      std::vector<TelemetryData> static_frames;
+      StaticPipeline pipeline(SampleParser{}, SampleConverter{},
+                              [&static_frames](const TelemetryData &frame)
+                              { static_frames.push_back(frame); });
+      PushInChunks(pipeline, bytes);
+
+      SampleParser parser;
+      SampleConverter converter;
+      std::vector<TelemetryData> dynamic_frames;
+      auto parsed = parser.OnPacketReceived.Connect(
+          [&converter](const std::shared_ptr<interfaces::IPacket> &packet)
+          { converter.Convert(packet); });
+      auto converted = converter.OnTelemetryConverted.Connect(
+          [&dynamic_frames](const TelemetryData &frame)
+          { dynamic_frames.push_back(frame); });
+      PushInChunks(parser, bytes);
+
+      GCS_ASSERT_EQ(static_frames.size(), 50u);
+      GCS_ASSERT_EQ(dynamic_frames.size(), 50u);
+      for (std::size_t i = 0; i < static_frames.size(); ++i)
+      {
+        GCS_EXPECT_EQ(static_frames[i].timestamp_us, dynamic_frames[i].timestamp_us);
+        GCS_EXPECT_EQ(static_frames[i].pos.z(), dynamic_frames[i].pos.z());
+      }
+    }
+
+    GCS_TEST(StaticPipelineTest, DropsCorruptedFrames)
+    {
+      auto bytes = MakeSampleStream(3);
+      bytes[testing::kSampleFrameSize + 3] ^= 0xFF; // Second frame's payload.
+
+      int frames = 0;
+      StaticPipeline pipeline(SampleParser{}, SampleConverter{},
+                              [&frames](const TelemetryData &)
+                              { ++frames; });
+      pipeline.PushData(bytes);
+      GCS_EXPECT_EQ(frames, 2);
+    }
+
+    GCS_TEST(StaticPipelineTest, PushDataDoesNotAllocate)
+    {
+      auto bytes = MakeSampleStream(200);
+      Signal<const TelemetryData &> on_telemetry;
+      std::uint64_t last = 0;
+      auto token = on_telemetry.Connect([&last](const TelemetryData &frame)
+                                        { last = frame.timestamp_us; });
+      StaticPipeline pipeline(SampleParser{}, SampleConverter{},
+                              DynamicSink(on_telemetry));
+
+      AllocationScope scope;
+      pipeline.PushData(bytes);
+      GCS_EXPECT_EQ(scope.GetCount(), 0u);
+      GCS_EXPECT_EQ(last, 1990000u);
+    }
+
+  } // namespace
+} // namespace gcs::common
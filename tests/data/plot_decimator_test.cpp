@@ -0,0 +1,146 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "data/plot_decimator.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "test_framework.h"
+
+namespace gcs::data
+{
+  namespace
+  {
+    constexpr TelemetryChannel kChannel = TelemetryChannel::kPosZ;
+    constexpr std::uint64_t kIntervalUs = 1000;
+
+    // Appends random frames to the store in uneven runs, updating the
+    // decimator after each, as a live plot would.
+    std::vector<double> Fill(TelemetryColumnStore &store, PlotDecimator &decimator,
+                             std::size_t frames, unsigned seed)
+    {
+      std::mt19937_64 rng(seed);
+      std::normal_distribution<double> noise(0.0, 1.0);
+      std::vector<double> values;
+      std::size_t appended = 0;
+      while (appended < frames)
+      {
+        std::size_t run = std::min<std::size_t>(frames - appended,
+                                                1 + rng() % 300);
+        std::vector<TelemetryData> batch(run);
+        for (TelemetryData &frame : batch)
+        {
+          frame.timestamp_us = appended * kIntervalUs;
+          frame.pos.data[2] = noise(rng) + (rng() % 997 == 0 ? 50.0 : 0.0);
+          values.push_back(frame.pos.z());
+          ++appended;
+        }
+        store.Append(batch);
+        decimator.Update();
+      }
+      return values;
+    }
+
+    GCS_TEST(PlotDecimatorTest, MinMaxKeepsExtremesOfEveryBucket)
+    {
+      TelemetryColumnStore store;
+      PlotDecimator decimator(store);
+      // Not a multiple of the leaf size, so the tail is a partial leaf.
+      const std::vector<double> values = Fill(store, decimator, 20011, 1);
+
+      for (auto [first, last] : {std::pair<std::size_t, std::size_t>{0, 20011},
+                                 {37, 19000},
+                                 {5000, 5900}})
+      {
+        constexpr std::size_t kBuckets = 100;
+        std::vector<PlotPoint> out;
+        decimator.DecimateFrames(kChannel, first, last, 2 * kBuckets,
+                                 DecimationMode::kMinMax, out);
+        GCS_ASSERT_EQ(out.size(), 2 * kBuckets);
+
+        const std::size_t count = last - first;
+        for (std::size_t b = 0; b < kBuckets; ++b)
+        {
+          auto begin = values.begin() + static_cast<std::ptrdiff_t>(first + count * b / kBuckets);
+          auto end = values.begin() + static_cast<std::ptrdiff_t>(first + count * (b + 1) / kBuckets);
+          auto min_it = std::min_element(begin, end);
+          auto max_it = std::max_element(begin, end);
+
+          // Each bucket contributes its two extremes in frame order.
+          const PlotPoint &a = out[2 * b];
+          const PlotPoint &c = out[2 * b + 1];
+          GCS_EXPECT_LT(a.timestamp_us, c.timestamp_us);
+          const PlotPoint &low = a.value < c.value ? a : c;
+          const PlotPoint &high = a.value < c.value ? c : a;
+          GCS_EXPECT_EQ(low.value, *min_it);
+          GCS_EXPECT_EQ(high.value, *max_it);
+          GCS_EXPECT_EQ(low.timestamp_us,
+                        static_cast<std::uint64_t>(min_it - values.begin()) * kIntervalUs);
+          GCS_EXPECT_EQ(high.timestamp_us,
+                        static_cast<std::uint64_t>(max_it - values.begin()) * kIntervalUs);
+        }
+      }
+    }
+
+    GCS_TEST(PlotDecimatorTest, LttbKeepsFirstAndLastPoints)
+    {
+      TelemetryColumnStore store;
+      PlotDecimator decimator(store);
+      const std::vector<double> values = Fill(store, decimator, 50000, 2);
+
+      // Short ranges pick from the raw frames.
+      constexpr std::size_t kPoints = 200;
+      std::vector<PlotPoint> out;
+      decimator.DecimateFrames(kChannel, 1000, 1700, kPoints,
+                               DecimationMode::kLttb, out);
+      GCS_ASSERT_EQ(out.size(), kPoints);
+      GCS_EXPECT_EQ(out.front().timestamp_us, 1000 * kIntervalUs);
+      GCS_EXPECT_EQ(out.front().value, values[1000]);
+      GCS_EXPECT_EQ(out.back().timestamp_us, 1699 * kIntervalUs);
+      GCS_EXPECT_EQ(out.back().value, values[1699]);
+
+      // Long ranges pick from min/max candidates of 2 * kPoints buckets;
+      // the endpoints are the first and last candidates.
+      decimator.DecimateFrames(kChannel, 0, values.size(), kPoints,
+                               DecimationMode::kLttb, out);
+      std::vector<PlotPoint> candidates;
+      decimator.DecimateFrames(kChannel, 0, values.size(), 4 * kPoints,
+                               DecimationMode::kMinMax, candidates);
+      GCS_ASSERT_EQ(out.size(), kPoints);
+      GCS_EXPECT_EQ(out.front().timestamp_us, candidates.front().timestamp_us);
+      GCS_EXPECT_EQ(out.back().timestamp_us, candidates.back().timestamp_us);
+
+      for (std::size_t i = 1; i < out.size(); ++i)
+      {
+        GCS_EXPECT_LT(out[i - 1].timestamp_us, out[i].timestamp_us);
+      }
+    }
+
+    GCS_TEST(PlotDecimatorTest, LttbKeepsIsolatedSpike)
+    {
+      TelemetryColumnStore store;
+      PlotDecimator decimator(store);
+      std::vector<TelemetryData> frames(4000);
+      for (std::size_t i = 0; i < frames.size(); ++i)
+      {
+        frames[i].timestamp_us = i * kIntervalUs;
+        frames[i].pos.data[2] = i == 2345 ? 100.0 : 1.0;
+      }
+      store.Append(frames);
+      decimator.Update();
+
+      std::vector<PlotPoint> out;
+      decimator.Decimate(kChannel, 0, 3999 * kIntervalUs, 50,
+                         DecimationMode::kLttb, out);
+      GCS_EXPECT_TRUE(std::any_of(out.begin(), out.end(), [](const PlotPoint &p)
+                                  { return p.value == 100.0 &&
+                                           p.timestamp_us == 2345 * kIntervalUs; }));
+    }
+
+  } // namespace
+} // namespace gcs::data
@@ -0,0 +1,228 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "data/telemetry_codec.h"
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "data/telemetry_channel.h"
+#include "test_framework.h"
+
+namespace gcs::data
+{
+  namespace
+  {
+    constexpr std::size_t kBlockFrames = 64;
+
+    // Compares every field bit for bit, so NaN payloads and signed zeros
+    // must survive the round trip.
+    bool SameBits(const TelemetryData &a, const TelemetryData &b)
+    {
+      for (std::size_t i = 0; i < kTelemetryChannelCount; ++i)
+      {
+        const auto channel = static_cast<TelemetryChannel>(i);
+        if (std::bit_cast<std::uint64_t>(GetChannelValue(a, channel)) !=
+            std::bit_cast<std::uint64_t>(GetChannelValue(b, channel)))
+          return false;
+      }
+      return a.timestamp_us == b.timestamp_us && a.rx_count == b.rx_count &&
+             a.tx_count == b.tx_count && a.fsm == b.fsm &&
+             a.sensor == b.sensor && a.ejection == b.ejection;
+    }
+
+    bool SameBits(const std::vector<TelemetryData> &a,
+                  const std::vector<TelemetryData> &b)
+    {
+      if (a.size() != b.size())
+        return false;
+      for (std::size_t i = 0; i < a.size(); ++i)
+      {
+        if (!SameBits(a[i], b[i]))
+          return false;
+      }
+      return true;
+    }
+
+    // A 100 Hz flight with float-quantized sensor noise.
+    std::vector<TelemetryData> MakeFlight(std::size_t count)
+    {
+      std::mt19937_64 rng(3);
+      std::normal_distribution<float> noise(0.0f, 0.05f);
+      std::vector<TelemetryData> frames(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        const double t = static_cast<double>(i) * 0.01;
+        TelemetryData &frame = frames[i];
+        frame.timestamp_us = 5000000 + i * 10000 + (i % 7 == 0 ? 1000 : 0);
+        frame.pos.data = {0.0, 0.0, 50.0 * t * t};
+        frame.vel.data = {0.0, 0.0, 100.0 * t};
+        frame.acc.data = {noise(rng), noise(rng), 100.0f + noise(rng)};
+        frame.quat.data = {std::cos(0.01 * t), 0.0, 0.0, std::sin(0.01 * t)};
+        frame.euler.data = {0.0, 0.0, 0.02 * t};
+        frame.rx_count = static_cast<std::uint32_t>(i);
+        frame.tx_count = static_cast<std::uint32_t>(i / 10);
+        frame.fsm = static_cast<std::uint8_t>(i / 200);
+        frame.sensor = 0x07;
+      }
+      return frames;
+    }
+
+    GCS_TEST(TelemetryCodecTest, RoundTripIsBitExact)
+    {
+      // Several full blocks and a partial last one.
+      const std::vector<TelemetryData> frames = MakeFlight(5 * kBlockFrames + 17);
+      const std::vector<std::uint8_t> stream = EncodeTelemetry(frames, kBlockFrames);
+      GCS_EXPECT_TRUE(SameBits(DecodeTelemetry(stream), frames));
+      GCS_EXPECT_LT(stream.size(), frames.size() * sizeof(TelemetryData));
+    }
+
+    GCS_TEST(TelemetryCodecTest, CountersWrap)
+    {
+      std::vector<TelemetryData> frames(12);
+      const std::uint64_t timestamps[] = {
+          std::numeric_limits<std::uint64_t>::max() - 20,
+          std::numeric_limits<std::uint64_t>::max() - 10,
+          std::numeric_limits<std::uint64_t>::max(),
+          9, // wraps past zero
+          19,
+          3, // steps back
+          std::numeric_limits<std::uint64_t>::max() / 2,
+          0,
+          0,
+          1,
+          std::numeric_limits<std::uint64_t>::max(),
+          1};
+      for (std::size_t i = 0; i < frames.size(); ++i)
+      {
+        frames[i].timestamp_us = timestamps[i];
+        frames[i].rx_count = 0xFFFFFFF0u + static_cast<std::uint32_t>(i * 5);
+        frames[i].tx_count = i % 2 == 0 ? 0u : 0xFFFFFFFFu;
+      }
+
+      const std::vector<std::uint8_t> stream = EncodeTelemetry(frames);
+      const std::vector<TelemetryData> decoded = DecodeTelemetry(stream);
+      GCS_EXPECT_TRUE(SameBits(decoded, frames));
+      GCS_ASSERT_EQ(decoded.size(), frames.size());
+      GCS_EXPECT_EQ(decoded[4].rx_count, 4u);
+    }
+
+    GCS_TEST(TelemetryCodecTest, SpecialValuesKeepTheirBits)
+    {
+      const double specials[] = {
+          std::bit_cast<double>(std::uint64_t{0x7FF8000000000001}), // qNaN
+          std::bit_cast<double>(std::uint64_t{0xFFF800000000BEEF}), // -qNaN
+          std::bit_cast<double>(std::uint64_t{0x7FF0000000000001}), // sNaN
+          -0.0,
+          0.0,
+          std::numeric_limits<double>::infinity(),
+          -std::numeric_limits<double>::infinity(),
+          std::numeric_limits<double>::denorm_min(),
+          -std::numeric_limits<double>::max(),
+          1.0};
+
+      std::vector<TelemetryData> frames;
+      for (std::size_t i = 0; i < 40; ++i)
+      {
+        TelemetryData frame;
+        frame.timestamp_us = i * 10000;
+        for (std::size_t c = 0; c < kTelemetryChannelCount; ++c)
+        {
+          SetChannelValue(frame, static_cast<TelemetryChannel>(c),
+                          specials[(i + c) % std::size(specials)]);
+        }
+        frames.push_back(frame);
+      }
+
+      GCS_EXPECT_TRUE(SameBits(DecodeTelemetry(EncodeTelemetry(frames, 16)),
+                               frames));
+    }
+
+    GCS_TEST(TelemetryCodecTest, TruncatedBlockStopsDecoding)
+    {
+      const std::vector<TelemetryData> frames = MakeFlight(3 * kBlockFrames);
+      const std::vector<std::uint8_t> stream = EncodeTelemetry(frames, kBlockFrames);
+      const std::vector<TelemetryBlockInfo> blocks =
+          TelemetryDecoder::ScanBlocks(stream);
+      GCS_ASSERT_EQ(blocks.size(), 3u);
+
+      // Cut the last block inside its payload, then inside its header.
+      for (std::size_t cut : {blocks[2].size / 2, std::size_t{5}})
+      {
+        std::span<const std::uint8_t> truncated(stream.data(),
+                                                blocks[2].offset + cut);
+        GCS_EXPECT_EQ(TelemetryDecoder::ScanBlocks(truncated).size(), 2u);
+
+        std::vector<TelemetryData> decoded = DecodeTelemetry(truncated);
+        GCS_EXPECT_TRUE(SameBits(
+            decoded, std::vector<TelemetryData>(
+                         frames.begin(), frames.begin() + 2 * kBlockFrames)));
+      }
+    }
+
+    GCS_TEST(TelemetryCodecTest, CorruptHeaderIsRejected)
+    {
+      std::vector<std::uint8_t> stream = EncodeTelemetry(MakeFlight(10));
+      stream[0] ^= 0xFF; // version
+      GCS_EXPECT_FALSE(TelemetryDecoder::ReadBlockInfo(stream, 0).has_value());
+      GCS_EXPECT_TRUE(DecodeTelemetry(stream).empty());
+    }
+
+    GCS_TEST(TelemetryCodecTest, SeekResumesAtAnyBlock)
+    {
+      const std::vector<TelemetryData> frames = MakeFlight(4 * kBlockFrames + 9);
+      const std::vector<std::uint8_t> stream = EncodeTelemetry(frames, kBlockFrames);
+      const std::vector<TelemetryBlockInfo> blocks =
+          TelemetryDecoder::ScanBlocks(stream);
+      GCS_ASSERT_EQ(blocks.size(), 5u);
+
+      TelemetryDecoder decoder(stream);
+      for (std::size_t b : {3u, 0u, 4u, 1u})
+      {
+        GCS_EXPECT_EQ(blocks[b].first_timestamp_us,
+                      frames[b * kBlockFrames].timestamp_us);
+        GCS_ASSERT_TRUE(decoder.Seek(blocks[b].offset));
+
+        // Decode across the next block boundary, if there is one.
+        TelemetryData frame;
+        for (std::size_t i = b * kBlockFrames;
+             i < std::min(frames.size(), (b + 2) * kBlockFrames); ++i)
+        {
+          GCS_ASSERT_TRUE(decoder.Decode(frame));
+          GCS_EXPECT_TRUE(SameBits(frame, frames[i]));
+        }
+      }
+
+      TelemetryData frame;
+      GCS_EXPECT_FALSE(decoder.Seek(blocks[1].offset + 1));
+      GCS_EXPECT_FALSE(decoder.Decode(frame));
+      GCS_EXPECT_FALSE(decoder.Seek(stream.size()));
+    }
+
+    GCS_TEST(TelemetryCodecTest, StreamingMatchesOneShot)
+    {
+      const std::vector<TelemetryData> frames = MakeFlight(3 * kBlockFrames + 5);
+      TelemetryEncoder encoder(kBlockFrames);
+      std::vector<std::uint8_t> stream;
+      for (std::size_t begin = 0; begin < frames.size(); begin += 50)
+      {
+        std::size_t count = std::min<std::size_t>(50, frames.size() - begin);
+        encoder.Encode(std::span(frames).subspan(begin, count));
+        std::vector<std::uint8_t> part = encoder.TakeOutput();
+        stream.insert(stream.end(), part.begin(), part.end());
+      }
+      GCS_EXPECT_EQ(encoder.GetPendingFrameCount(), 5u);
+      encoder.Flush();
+      std::vector<std::uint8_t> tail = encoder.TakeOutput();
+      stream.insert(stream.end(), tail.begin(), tail.end());
+
+      GCS_EXPECT_TRUE(stream == EncodeTelemetry(frames, kBlockFrames));
+    }
+
+  } // namespace
+} // namespace gcs::data
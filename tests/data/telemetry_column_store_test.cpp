@@ -0,0 +1,159 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "data/telemetry_column_store.h"
+
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "alloc_counter.h"
+#include "test_framework.h"
+
+namespace gcs::data
+{
+  namespace
+  {
+    using testing::AllocationScope;
+
+    constexpr std::size_t kChunk = TelemetryColumnStore::kChunkFrames;
+
+    // A frame whose every field is derived from i, so mixed-up rows or
+    // columns show up as mismatches.
+    TelemetryData MakeFrame(std::size_t i)
+    {
+      const double x = static_cast<double>(i);
+      TelemetryData frame;
+      frame.timestamp_us = 1000000 + i * 500;
+      for (std::size_t c = 0; c < kTelemetryChannelCount; ++c)
+      {
+        SetChannelValue(frame, static_cast<TelemetryChannel>(c),
+                        x + 0.01 * static_cast<double>(c));
+      }
+      frame.rx_count = static_cast<std::uint32_t>(i);
+      frame.tx_count = static_cast<std::uint32_t>(2 * i);
+      frame.fsm = static_cast<std::uint8_t>(i % 7);
+      frame.sensor = static_cast<std::uint8_t>(i % 11);
+      frame.ejection = static_cast<std::uint8_t>(i % 3);
+      return frame;
+    }
+
+    std::vector<TelemetryData> MakeFrames(std::size_t first, std::size_t count)
+    {
+      std::vector<TelemetryData> frames;
+      frames.reserve(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        frames.push_back(MakeFrame(first + i));
+      }
+      return frames;
+    }
+
+    bool SameFrame(const TelemetryData &a, const TelemetryData &b)
+    {
+      return a.timestamp_us == b.timestamp_us && a.pos.data == b.pos.data &&
+             a.vel.data == b.vel.data && a.acc.data == b.acc.data &&
+             a.quat.data == b.quat.data && a.euler.data == b.euler.data &&
+             a.rx_count == b.rx_count && a.tx_count == b.tx_count &&
+             a.fsm == b.fsm && a.sensor == b.sensor && a.ejection == b.ejection;
+    }
+
+    GCS_TEST(TelemetryColumnStoreTest, AppendRunCrossesChunkBoundary)
+    {
+      TelemetryColumnStore store;
+      store.Append(MakeFrames(0, kChunk - 1));
+      GCS_EXPECT_EQ(store.GetChunkCount(), 1u);
+
+      // One frame fills the first chunk, the rest spill into the second.
+      store.Append(MakeFrames(kChunk - 1, 5));
+      GCS_EXPECT_EQ(store.GetFrameCount(), kChunk + 4);
+      GCS_EXPECT_EQ(store.GetChunkCount(), 2u);
+
+      auto timestamps = store.GetTimestamps();
+      auto pos_z = store.GetChannel(TelemetryChannel::kPosZ);
+      for (std::size_t i = kChunk - 3; i < kChunk + 4; ++i)
+      {
+        GCS_EXPECT_EQ(timestamps[i], MakeFrame(i).timestamp_us);
+        GCS_EXPECT_EQ(pos_z[i], MakeFrame(i).pos.z());
+      }
+      GCS_EXPECT_EQ(timestamps.GetChunk(1)[0], MakeFrame(kChunk).timestamp_us);
+    }
+
+    GCS_TEST(TelemetryColumnStoreTest, GetFrameRoundTripsEveryField)
+    {
+      TelemetryColumnStore store;
+      const std::vector<TelemetryData> frames = MakeFrames(0, kChunk + 100);
+      // Single appends and runs both end up in the same layout.
+      store.Append(frames[0]);
+      store.Append(std::span(frames).subspan(1));
+
+      GCS_ASSERT_EQ(store.GetFrameCount(), frames.size());
+      for (std::size_t i : {std::size_t{0}, std::size_t{1}, kChunk - 1, kChunk,
+                            frames.size() - 1})
+      {
+        GCS_EXPECT_TRUE(SameFrame(store.GetFrame(i), frames[i]));
+      }
+    }
+
+    GCS_TEST(TelemetryColumnStoreTest, LastChunkSpanCoversOnlyStoredFrames)
+    {
+      TelemetryColumnStore store;
+      store.Append(MakeFrames(0, 2 * kChunk + 37));
+
+      auto rx = store.GetRxCounts();
+      GCS_ASSERT_EQ(rx.GetChunkCount(), 3u);
+      GCS_EXPECT_EQ(rx.GetChunk(0).size(), kChunk);
+      GCS_EXPECT_EQ(rx.GetChunk(1).size(), kChunk);
+      GCS_EXPECT_EQ(rx.GetChunk(2).size(), 37u);
+      GCS_EXPECT_EQ(rx.GetChunk(2).back(), 2 * kChunk + 36);
+
+      auto euler = store.GetChannel(TelemetryChannel::kEulerZ);
+      GCS_EXPECT_EQ(euler.GetChunk(2).size(), 37u);
+      GCS_EXPECT_EQ(reinterpret_cast<std::uintptr_t>(euler.GetChunk(2).data()) %
+                        TelemetryColumnStore::kColumnAlignment,
+                    0u);
+    }
+
+    GCS_TEST(TelemetryColumnStoreTest, ReserveThenAppendDoesNotAllocate)
+    {
+      TelemetryColumnStore store;
+      const std::vector<TelemetryData> frames = MakeFrames(0, 3 * kChunk);
+      store.Reserve(frames.size());
+
+      AllocationScope scope;
+      store.Append(std::span(frames).first(kChunk / 2));
+      const double *first_chunk =
+          store.GetChannel(TelemetryChannel::kPosX).GetChunk(0).data();
+      store.Append(std::span(frames).subspan(kChunk / 2));
+      GCS_EXPECT_EQ(scope.GetCount(), 0u);
+
+      // Earlier chunks never move.
+      GCS_EXPECT_EQ(store.GetChannel(TelemetryChannel::kPosX).GetChunk(0).data(),
+                    first_chunk);
+      GCS_EXPECT_EQ(store.GetFrameCount(), frames.size());
+    }
+
+    GCS_TEST(TelemetryColumnStoreTest, MovedFromStoreIsEmpty)
+    {
+      TelemetryColumnStore store;
+      store.Append(MakeFrames(0, 10));
+
+      TelemetryColumnStore moved(std::move(store));
+      GCS_EXPECT_EQ(store.GetFrameCount(), 0u);
+      GCS_EXPECT_EQ(store.GetChunkCount(), 0u);
+      GCS_EXPECT_EQ(moved.GetFrameCount(), 10u);
+
+      TelemetryColumnStore assigned;
+      assigned = std::move(moved);
+      GCS_EXPECT_EQ(moved.GetFrameCount(), 0u);
+      GCS_EXPECT_TRUE(SameFrame(assigned.GetFrame(9), MakeFrame(9)));
+
+      // A moved-from store can be reused.
+      store.Append(MakeFrame(42));
+      GCS_EXPECT_TRUE(SameFrame(store.GetFrame(0), MakeFrame(42)));
+    }
+
+  } // namespace
+} // namespace gcs::data
@@ -0,0 +1,175 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "data/telemetry_history.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "data/telemetry_channel.h"
+#include "test_framework.h"
+
+namespace gcs::data
+{
+  namespace
+  {
+    // Every field encodes the frame's sequence number, so a frame mixed
+    // from two stores fails ConsistentSequence.
+    TelemetryData MakeFrame(std::uint64_t sequence)
+    {
+      TelemetryData frame;
+      frame.timestamp_us = sequence * 1000;
+      for (std::size_t c = 0; c < kTelemetryChannelCount; ++c)
+      {
+        SetChannelValue(frame, static_cast<TelemetryChannel>(c),
+                        static_cast<double>(sequence + c));
+      }
+      frame.rx_count = static_cast<std::uint32_t>(sequence);
+      frame.tx_count = ~static_cast<std::uint32_t>(sequence);
+      frame.fsm = static_cast<std::uint8_t>(sequence);
+      return frame;
+    }
+
+    // Returns whether every field agrees on one sequence number.
+    bool ConsistentSequence(const TelemetryData &frame, std::uint64_t &sequence)
+    {
+      sequence = frame.timestamp_us / 1000;
+      if (frame.timestamp_us != sequence * 1000 ||
+          frame.rx_count != static_cast<std::uint32_t>(sequence) ||
+          frame.tx_count != ~static_cast<std::uint32_t>(sequence) ||
+          frame.fsm != static_cast<std::uint8_t>(sequence))
+        return false;
+      for (std::size_t c = 0; c < kTelemetryChannelCount; ++c)
+      {
+        if (GetChannelValue(frame, static_cast<TelemetryChannel>(c)) !=
+            static_cast<double>(sequence + c))
+          return false;
+      }
+      return true;
+    }
+
+    GCS_TEST(TelemetryHistoryTest, OverwrittenFramesAreNotRead)
+    {
+      TelemetryHistory history(8);
+      for (std::uint64_t n = 0; n < 20; ++n)
+      {
+        history.Publish(MakeFrame(n));
+      }
+
+      TelemetryData frame;
+      std::uint64_t sequence = 0;
+      GCS_EXPECT_FALSE(history.Read(11, frame));
+      GCS_EXPECT_FALSE(history.Read(20, frame));
+      GCS_ASSERT_TRUE(history.Read(12, frame));
+      GCS_EXPECT_TRUE(ConsistentSequence(frame, sequence));
+      GCS_EXPECT_EQ(sequence, 12u);
+
+      std::uint64_t cursor = 5;
+      std::vector<TelemetryData> out;
+      GCS_EXPECT_EQ(history.ReadSince(cursor, out), 7u);
+      GCS_EXPECT_EQ(out.size(), 8u);
+      GCS_EXPECT_EQ(cursor, 20u);
+    }
+
+    GCS_TEST(TelemetryHistoryTest, ConcurrentReadersSeeNoTornFrames)
+    {
+      // A small ring so that the producer keeps lapping the readers.
+      constexpr std::uint64_t kFrames = 200000;
+      TelemetryHistory history(64);
+      std::atomic<bool> done = false;
+      std::atomic<int> torn = 0;
+      std::atomic<int> out_of_order = 0;
+
+      std::vector<std::thread> readers;
+      // Incremental readers: each frame they get is intact and comes
+      // strictly after the previous one.
+      for (int r = 0; r < 2; ++r)
+      {
+        readers.emplace_back([&]()
+                             {
+                               std::uint64_t cursor = 0;
+                               std::uint64_t last = 0;
+                               bool first = true;
+                               std::vector<TelemetryData> out;
+                               while (!done.load() || cursor < history.GetPublishedCount())
+                               {
+                                 out.clear();
+                                 history.ReadSince(cursor, out);
+                                 for (const TelemetryData &frame : out)
+                                 {
+                                   std::uint64_t sequence = 0;
+                                   if (!ConsistentSequence(frame, sequence))
+                                     ++torn;
+                                   else if (!first && sequence <= last)
+                                     ++out_of_order;
+                                   last = sequence;
+                                   first = false;
+                                 }
+                                 std::this_thread::yield();
+                               } });
+      }
+      // Snapshot readers: the newest frame never goes backwards, and a
+      // copied window is a contiguous run.
+      readers.emplace_back([&]()
+                           {
+                             std::uint64_t last = 0;
+                             std::vector<TelemetryData> window;
+                             TelemetryData frame;
+                             while (!done.load())
+                             {
+                               std::uint64_t sequence = 0;
+                               if (history.ReadLatest(frame))
+                               {
+                                 if (!ConsistentSequence(frame, sequence))
+                                   ++torn;
+                                 else if (sequence < last)
+                                   ++out_of_order;
+                                 last = sequence;
+                               }
+
+                               history.CopyLatest(32, window);
+                               for (std::size_t i = 0; i < window.size(); ++i)
+                               {
+                                 std::uint64_t previous = sequence;
+                                 if (!ConsistentSequence(window[i], sequence))
+                                   ++torn;
+                                 else if (i > 0 && sequence != previous + 1)
+                                   ++out_of_order;
+                               }
+                               std::this_thread::yield();
+                             } });
+
+      std::vector<TelemetryData> batch;
+      for (std::uint64_t n = 0; n < kFrames;)
+      {
+        // Alternate single frames and runs, like a converter would.
+        if (n % 2 == 0)
+        {
+          history.Publish(MakeFrame(n++));
+        }
+        else
+        {
+          batch.clear();
+          for (int i = 0; i < 7 && n < kFrames; ++i)
+            batch.push_back(MakeFrame(n++));
+          history.Publish(batch);
+        }
+        if (n % 1024 < 8)
+          std::this_thread::yield();
+      }
+      done = true;
+      for (auto &reader : readers)
+      {
+        reader.join();
+      }
+
+      GCS_EXPECT_EQ(torn.load(), 0);
+      GCS_EXPECT_EQ(out_of_order.load(), 0);
+      GCS_EXPECT_EQ(history.GetPublishedCount(), kFrames);
+    }
+
+  } // namespace
+} // namespace gcs::data
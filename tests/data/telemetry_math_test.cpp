@@ -0,0 +1,324 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "data/telemetry_math.h"
+
+#include <array>
+#include <cmath>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "test_framework.h"
+
+namespace gcs::data
+{
+  namespace
+  {
+    // Odd length so every vector path also runs its scalar tail.
+    constexpr std::size_t kCount = 1027;
+
+    // Restores the kernel dispatch level when a test ends.
+    class SimdLevelScope
+    {
+    public:
+      explicit SimdLevelScope(SimdLevel level) : saved_(GetSimdLevel())
+      {
+        SetSimdLevel(level);
+      }
+      ~SimdLevelScope() { SetSimdLevel(saved_); }
+
+    private:
+      SimdLevel saved_;
+    };
+
+    std::vector<SimdLevel> SupportedLevels()
+    {
+      std::vector<SimdLevel> levels = {SimdLevel::kScalar};
+      if (GetSupportedSimdLevel() >= SimdLevel::kSse4)
+        levels.push_back(SimdLevel::kSse4);
+      if (GetSupportedSimdLevel() >= SimdLevel::kAvx2)
+        levels.push_back(SimdLevel::kAvx2);
+      return levels;
+    }
+
+    // Owns the storage behind a set of component columns.
+    template <std::size_t N>
+    struct Columns
+    {
+      explicit Columns(std::size_t count = kCount)
+      {
+        for (auto &column : data)
+          column.resize(count);
+      }
+
+      QuatColumns Quat() { return {data[0], data[1], data[2], data[3]}; }
+      Vec3Columns Vec3() { return {data[0], data[1], data[2]}; }
+
+      std::vector<double> data[N];
+    };
+
+    using QuatData = Columns<4>;
+    using Vec3Data = Columns<3>;
+
+    template <std::size_t N>
+    bool operator==(const Columns<N> &a, const Columns<N> &b)
+    {
+      for (std::size_t c = 0; c < N; ++c)
+      {
+        if (a.data[c] != b.data[c])
+          return false;
+      }
+      return true;
+    }
+
+    QuatData RandomUnitQuats(std::mt19937_64 &rng)
+    {
+      std::normal_distribution<double> normal;
+      QuatData quats;
+      for (auto &column : quats.data)
+      {
+        for (double &v : column)
+          v = normal(rng);
+      }
+      scalar::NormalizeQuaternions(quats.Quat());
+      return quats;
+    }
+
+    Vec3Data RandomVectors(std::mt19937_64 &rng)
+    {
+      std::uniform_real_distribution<double> value(-100.0, 100.0);
+      Vec3Data vectors;
+      for (auto &column : vectors.data)
+      {
+        for (double &v : column)
+          v = value(rng);
+      }
+      return vectors;
+    }
+
+    std::vector<double> RandomFractions(std::mt19937_64 &rng)
+    {
+      std::uniform_real_distribution<double> unit(0.0, 1.0);
+      std::vector<double> t(kCount);
+      for (double &v : t)
+        v = unit(rng);
+      t[0] = 0.0;
+      t[1] = 1.0;
+      return t;
+    }
+
+    // --- Vector paths against the scalar reference ---
+
+    GCS_TEST(TelemetryMathTest, NormalizeQuaternionsMatchesScalarAtEveryLevel)
+    {
+      std::mt19937_64 rng(1);
+      std::normal_distribution<double> normal(0.0, 10.0);
+      QuatData input;
+      for (auto &column : input.data)
+      {
+        for (double &v : column)
+          v = normal(rng);
+      }
+
+      QuatData expected = input;
+      scalar::NormalizeQuaternions(expected.Quat());
+
+      for (SimdLevel level : SupportedLevels())
+      {
+        SimdLevelScope scope(level);
+        QuatData out = input;
+        NormalizeQuaternions(out.Quat());
+        GCS_EXPECT_TRUE(out == expected);
+      }
+    }
+
+    GCS_TEST(TelemetryMathTest, QuaternionsToEulerMatchesScalarAtEveryLevel)
+    {
+      std::mt19937_64 rng(2);
+      QuatData quats = RandomUnitQuats(rng);
+      // Gimbal lock, where pitch is clamped to +-90 degrees.
+      const double half = std::sqrt(0.5);
+      quats.data[0][3] = half;
+      quats.data[1][3] = 0.0;
+      quats.data[2][3] = half;
+      quats.data[3][3] = 0.0;
+
+      Vec3Data expected;
+      scalar::QuaternionsToEuler(quats.Quat(), expected.Vec3());
+
+      for (SimdLevel level : SupportedLevels())
+      {
+        SimdLevelScope scope(level);
+        Vec3Data out;
+        QuaternionsToEuler(quats.Quat(), out.Vec3());
+        GCS_EXPECT_TRUE(out == expected);
+      }
+    }
+
+    GCS_TEST(TelemetryMathTest, RotateToWorldMatchesScalarAtEveryLevel)
+    {
+      std::mt19937_64 rng(3);
+      QuatData quats = RandomUnitQuats(rng);
+      Vec3Data body = RandomVectors(rng);
+
+      Vec3Data expected;
+      scalar::RotateToWorld(quats.Quat(), body.Vec3(), expected.Vec3());
+
+      for (SimdLevel level : SupportedLevels())
+      {
+        SimdLevelScope scope(level);
+        Vec3Data out;
+        RotateToWorld(quats.Quat(), body.Vec3(), out.Vec3());
+        GCS_EXPECT_TRUE(out == expected);
+      }
+    }
+
+    GCS_TEST(TelemetryMathTest, ComputeNormsMatchesScalarAtEveryLevel)
+    {
+      std::mt19937_64 rng(4);
+      Vec3Data vectors = RandomVectors(rng);
+
+      std::vector<double> expected(kCount);
+      scalar::ComputeNorms(vectors.Vec3(), expected);
+
+      for (SimdLevel level : SupportedLevels())
+      {
+        SimdLevelScope scope(level);
+        std::vector<double> out(kCount);
+        ComputeNorms(vectors.Vec3(), out);
+        GCS_EXPECT_TRUE(out == expected);
+      }
+    }
+
+    GCS_TEST(TelemetryMathTest, LerpMatchesScalarAtEveryLevel)
+    {
+      std::mt19937_64 rng(7);
+      std::uniform_real_distribution<double> value(-1000.0, 1000.0);
+      std::vector<double> from(kCount), to(kCount);
+      for (std::size_t i = 0; i < kCount; ++i)
+      {
+        from[i] = value(rng);
+        to[i] = value(rng);
+      }
+      std::vector<double> t = RandomFractions(rng);
+
+      std::vector<double> expected(kCount);
+      scalar::Lerp(from, to, t, expected);
+      GCS_EXPECT_EQ(expected[0], from[0]);
+      GCS_EXPECT_EQ(expected[1], to[1]);
+
+      for (SimdLevel level : SupportedLevels())
+      {
+        SimdLevelScope scope(level);
+        std::vector<double> out(kCount);
+        Lerp(from, to, t, out);
+        GCS_EXPECT_TRUE(out == expected);
+      }
+    }
+
+    GCS_TEST(TelemetryMathTest, SlerpMatchesScalarAtEveryLevel)
+    {
+      std::mt19937_64 rng(11);
+      std::normal_distribution<double> normal;
+      QuatData from = RandomUnitQuats(rng);
+      QuatData to = RandomUnitQuats(rng);
+      for (std::size_t i = 0; i < kCount; i += 5)
+      {
+        // Nearly parallel pairs take the normalized-lerp branch, and every
+        // other one sits in the opposite hemisphere.
+        const double sign = i % 10 == 0 ? -1.0 : 1.0;
+        for (int c = 0; c < 4; ++c)
+          to.data[c][i] = sign * (from.data[c][i] + 1e-4 * normal(rng));
+      }
+      scalar::NormalizeQuaternions(to.Quat());
+      std::vector<double> t = RandomFractions(rng);
+
+      QuatData expected;
+      scalar::Slerp(from.Quat(), to.Quat(), t, expected.Quat());
+
+      for (SimdLevel level : SupportedLevels())
+      {
+        SimdLevelScope scope(level);
+        QuatData out;
+        Slerp(from.Quat(), to.Quat(), t, out.Quat());
+        GCS_EXPECT_TRUE(out == expected);
+      }
+    }
+
+    // --- Edge cases ---
+
+    GCS_TEST(TelemetryMathTest, ZeroQuaternionIsLeftUnchanged)
+    {
+      std::mt19937_64 rng(5);
+      for (SimdLevel level : SupportedLevels())
+      {
+        SimdLevelScope scope(level);
+        QuatData quats = RandomUnitQuats(rng);
+        for (std::size_t i = 0; i < kCount; i += 3)
+        {
+          for (auto &column : quats.data)
+            column[i] = 0.0;
+        }
+
+        NormalizeQuaternions(quats.Quat());
+        for (std::size_t i = 0; i < kCount; ++i)
+        {
+          const double norm = std::sqrt(
+              quats.data[0][i] * quats.data[0][i] +
+              quats.data[1][i] * quats.data[1][i] +
+              quats.data[2][i] * quats.data[2][i] +
+              quats.data[3][i] * quats.data[3][i]);
+          GCS_EXPECT_NEAR(norm, i % 3 == 0 ? 0.0 : 1.0, 1e-12);
+        }
+      }
+
+      TelemetryData frame;
+      frame.quat.data = {0.0, 0.0, 0.0, 0.0};
+      NormalizeQuaternions(std::span<TelemetryData>(&frame, 1));
+      GCS_EXPECT_TRUE(frame.quat.data == (std::array<double, 4>{0.0, 0.0, 0.0, 0.0}));
+    }
+
+    GCS_TEST(TelemetryMathTest, MismatchedLengthsThrow)
+    {
+      std::mt19937_64 rng(6);
+      QuatData quats = RandomUnitQuats(rng);
+      QuatData short_quats(kCount - 1);
+      Vec3Data vectors = RandomVectors(rng);
+      Vec3Data short_vectors(kCount - 1);
+      std::vector<double> t(kCount, 0.5);
+      std::vector<double> short_t(kCount - 1, 0.5);
+      std::vector<double> norms(kCount);
+
+      QuatColumns ragged = quats.Quat();
+      ragged.z = ragged.z.first(kCount - 1);
+
+      for (SimdLevel level : SupportedLevels())
+      {
+        SimdLevelScope scope(level);
+        GCS_EXPECT_THROW(NormalizeQuaternions(ragged), std::invalid_argument);
+        GCS_EXPECT_THROW(QuaternionsToEuler(quats.Quat(), short_vectors.Vec3()),
+                         std::invalid_argument);
+        GCS_EXPECT_THROW(RotateToWorld(quats.Quat(), short_vectors.Vec3(),
+                                       vectors.Vec3()),
+                         std::invalid_argument);
+        GCS_EXPECT_THROW(ComputeNorms(short_vectors.Vec3(), norms),
+                         std::invalid_argument);
+        GCS_EXPECT_THROW(Lerp(t, short_t, t, norms), std::invalid_argument);
+        GCS_EXPECT_THROW(Slerp(quats.Quat(), short_quats.Quat(), t,
+                               quats.Quat()),
+                         std::invalid_argument);
+      }
+
+      std::vector<TelemetryData> frames(4);
+      std::vector<Vec3> world(3);
+      std::vector<double> frame_norms(2);
+      GCS_EXPECT_THROW(RotateAccelerationToWorld(frames, world),
+                       std::invalid_argument);
+      GCS_EXPECT_THROW(ComputeNorms(world, frame_norms), std::invalid_argument);
+    }
+
+  } // namespace
+} // namespace gcs::data
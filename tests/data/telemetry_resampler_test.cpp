@@ -0,0 +1,218 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "data/telemetry_resampler.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "test_framework.h"
+
+namespace gcs::data
+{
+  namespace
+  {
+    using std::chrono::microseconds;
+
+    constexpr std::uint64_t kPeriodUs = 10000;
+    constexpr microseconds kPeriod(kPeriodUs);
+
+    TelemetryData MakeFrame(std::uint64_t timestamp_us, double value)
+    {
+      TelemetryData frame;
+      frame.timestamp_us = timestamp_us;
+      frame.pos.data = {value, 2.0 * value, -value};
+      frame.vel.data = {value, 0.0, 1.0};
+      frame.acc.data = {0.0, value, 0.0};
+      frame.euler.data = {0.0, 0.0, value};
+      frame.quat.data = {1.0, 0.0, 0.0, 0.0};
+      return frame;
+    }
+
+    // Unit quaternion for a rotation of angle radians about z.
+    Quat YawQuat(double angle)
+    {
+      Quat quat;
+      quat.data = {std::cos(angle / 2.0), 0.0, 0.0, std::sin(angle / 2.0)};
+      return quat;
+    }
+
+    std::vector<TelemetryData> Resample(TelemetryResampler &resampler,
+                                        const std::vector<TelemetryData> &in)
+    {
+      std::vector<TelemetryData> out;
+      resampler.Process(in, out);
+      return out;
+    }
+
+    GCS_TEST(TelemetryResamplerTest, TicksAreAlignedToPeriod)
+    {
+      TelemetryResampler resampler(kPeriod);
+      std::vector<TelemetryData> in;
+      const std::uint64_t jitter[] = {3100, 7400, 1200, 9900, 5000, 300};
+      for (std::uint64_t i = 0; i < 30; ++i)
+      {
+        in.push_back(MakeFrame(1000000 + i * kPeriodUs + jitter[i % 6],
+                               static_cast<double>(i)));
+      }
+
+      std::vector<TelemetryData> out = Resample(resampler, in);
+      GCS_ASSERT_EQ(out.size(), 29u);
+      GCS_EXPECT_EQ(out.front().timestamp_us, 1010000u);
+      for (std::size_t i = 0; i < out.size(); ++i)
+      {
+        GCS_EXPECT_EQ(out[i].timestamp_us, 1010000 + i * kPeriodUs);
+      }
+    }
+
+    GCS_TEST(TelemetryResamplerTest, InterpolatesBetweenNeighbours)
+    {
+      TelemetryResampler resampler(kPeriod);
+      TelemetryData a = MakeFrame(2000, 0.0);
+      TelemetryData b = MakeFrame(12000, 10.0);
+      TelemetryData c = MakeFrame(27000, 40.0);
+      a.quat = YawQuat(0.0);
+      b.quat = YawQuat(1.0);
+      c.quat = YawQuat(2.5);
+
+      std::vector<TelemetryData> out = Resample(resampler, {a, b, c});
+      GCS_ASSERT_EQ(out.size(), 2u);
+
+      // 10000 is 80% of the way from a to b, 20000 is 8/15 from b to c.
+      GCS_EXPECT_NEAR(out[0].pos.x(), 8.0, 1e-12);
+      GCS_EXPECT_NEAR(out[0].pos.y(), 16.0, 1e-12);
+      GCS_EXPECT_NEAR(out[1].pos.x(), 10.0 + 30.0 * 8.0 / 15.0, 1e-12);
+      GCS_EXPECT_NEAR(out[1].euler.z(), out[1].pos.x(), 1e-12);
+
+      const Quat expected0 = YawQuat(0.8);
+      const Quat expected1 = YawQuat(1.0 + 1.5 * 8.0 / 15.0);
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+        GCS_EXPECT_NEAR(out[0].quat[i], expected0[i], 1e-12);
+        GCS_EXPECT_NEAR(out[1].quat[i], expected1[i], 1e-12);
+      }
+    }
+
+    GCS_TEST(TelemetryResamplerTest, FrameOnTickIsCopied)
+    {
+      TelemetryResampler resampler(kPeriod);
+      TelemetryData a = MakeFrame(10000, 1.0);
+      TelemetryData b = MakeFrame(20000, 3.0);
+      std::vector<TelemetryData> out = Resample(resampler, {a, b});
+      GCS_ASSERT_EQ(out.size(), 2u);
+      GCS_EXPECT_EQ(out[0].pos.x(), 1.0);
+      GCS_EXPECT_EQ(out[1].pos.x(), 3.0);
+      GCS_EXPECT_EQ(out[1].timestamp_us, 20000u);
+    }
+
+    GCS_TEST(TelemetryResamplerTest, DiscreteFieldsHoldLastValue)
+    {
+      TelemetryResampler resampler(kPeriod);
+      TelemetryData a = MakeFrame(5000, 0.0);
+      a.fsm = 1;
+      a.sensor = 0x01;
+      a.rx_count = 10;
+      TelemetryData b = MakeFrame(30000, 1.0);
+      b.fsm = 2;
+      b.sensor = 0x03;
+      b.ejection = 1;
+      b.rx_count = 20;
+      TelemetryData c = MakeFrame(40000, 2.0);
+      c.fsm = 3;
+
+      std::vector<TelemetryData> out = Resample(resampler, {a, b, c});
+      GCS_ASSERT_EQ(out.size(), 4u);
+      // Ticks 10000 and 20000 fall between a and b.
+      for (int i = 0; i < 2; ++i)
+      {
+        GCS_EXPECT_EQ(out[i].fsm, 1);
+        GCS_EXPECT_EQ(out[i].sensor, 0x01);
+        GCS_EXPECT_EQ(out[i].ejection, 0);
+        GCS_EXPECT_EQ(out[i].rx_count, 10u);
+      }
+      // Tick 30000 lands on b, tick 40000 on c.
+      GCS_EXPECT_EQ(out[2].fsm, 2);
+      GCS_EXPECT_EQ(out[2].ejection, 1);
+      GCS_EXPECT_EQ(out[2].rx_count, 20u);
+      GCS_EXPECT_EQ(out[3].fsm, 3);
+    }
+
+    GCS_TEST(TelemetryResamplerTest, GapRestartsClock)
+    {
+      TelemetryResampler resampler(kPeriod,
+                                   microseconds(50000));
+      std::vector<TelemetryData> in = {
+          MakeFrame(0, 0.0), MakeFrame(10000, 1.0), MakeFrame(20000, 2.0),
+          // 60 ms gap: nothing is interpolated across it.
+          MakeFrame(80500, 100.0), MakeFrame(95000, 200.0)};
+
+      std::vector<TelemetryData> out = Resample(resampler, in);
+      GCS_ASSERT_EQ(out.size(), 4u);
+      GCS_EXPECT_EQ(out[2].timestamp_us, 20000u);
+      GCS_EXPECT_EQ(out[3].timestamp_us, 90000u);
+      GCS_EXPECT_GE(out[3].pos.x(), 100.0);
+    }
+
+    GCS_TEST(TelemetryResamplerTest, BackstepRestartsClock)
+    {
+      TelemetryResampler resampler(kPeriod);
+      std::vector<TelemetryData> out =
+          Resample(resampler, {MakeFrame(100000, 10.0), MakeFrame(120000, 12.0)});
+      GCS_ASSERT_EQ(out.size(), 3u);
+
+      // A seek back in the log.
+      out = Resample(resampler, {MakeFrame(43000, 4.3), MakeFrame(51000, 5.1),
+                                 MakeFrame(60000, 6.0)});
+      GCS_ASSERT_EQ(out.size(), 2u);
+      GCS_EXPECT_EQ(out[0].timestamp_us, 50000u);
+      GCS_EXPECT_NEAR(out[0].pos.x(), 4.3 + 0.8 * 7.0 / 8.0, 1e-12);
+      GCS_EXPECT_EQ(out[1].timestamp_us, 60000u);
+    }
+
+    GCS_TEST(TelemetryResamplerTest, SplitInputMatchesSingleRun)
+    {
+      std::vector<TelemetryData> in;
+      for (std::uint64_t i = 0; i < 200; ++i)
+      {
+        in.push_back(MakeFrame(i * 7300 + (i % 3) * 900, std::sin(0.1 * i)));
+        in.back().quat = YawQuat(0.05 * static_cast<double>(i));
+      }
+
+      TelemetryResampler whole(kPeriod);
+      std::vector<TelemetryData> expected = Resample(whole, in);
+
+      TelemetryResampler split(kPeriod);
+      std::vector<TelemetryData> out;
+      for (std::size_t begin = 0; begin < in.size(); begin += 13)
+      {
+        std::size_t count = std::min<std::size_t>(13, in.size() - begin);
+        split.Process(std::span(in).subspan(begin, count), out);
+      }
+
+      GCS_ASSERT_EQ(out.size(), expected.size());
+      for (std::size_t i = 0; i < out.size(); ++i)
+      {
+        GCS_EXPECT_EQ(out[i].timestamp_us, expected[i].timestamp_us);
+        GCS_EXPECT_TRUE(out[i].pos.data == expected[i].pos.data);
+        GCS_EXPECT_TRUE(out[i].quat.data == expected[i].quat.data);
+      }
+    }
+
+    GCS_TEST(TelemetryResamplerTest, ResetForgetsStream)
+    {
+      TelemetryResampler resampler(kPeriod);
+      Resample(resampler, {MakeFrame(0, 0.0), MakeFrame(5000, 1.0)});
+      resampler.Reset();
+
+      // Without Reset, 10000 would be interpolated from the 5000 frame.
+      std::vector<TelemetryData> out =
+          Resample(resampler, {MakeFrame(8000, 8.0), MakeFrame(12000, 12.0)});
+      GCS_ASSERT_EQ(out.size(), 1u);
+      GCS_EXPECT_NEAR(out[0].pos.x(), 10.0, 1e-12);
+    }
+
+  } // namespace
+} // namespace gcs::data
@@ -0,0 +1,173 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "data/telemetry_stats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "test_framework.h"
+
+namespace gcs::data
+{
+  namespace
+  {
+    // Fraction of sorted values strictly below x.
+    double Rank(const std::vector<double> &sorted, double x)
+    {
+      auto below = std::lower_bound(sorted.begin(), sorted.end(), x);
+      return static_cast<double>(below - sorted.begin()) /
+             static_cast<double>(sorted.size());
+    }
+
+    GCS_TEST(TelemetryStatsTest, WelfordMatchesTwoPass)
+    {
+      // A large offset is where a sum of squares loses every digit.
+      std::mt19937_64 rng(1);
+      std::normal_distribution<double> noise(0.0, 0.5);
+      std::vector<double> values(100000);
+      for (double &v : values)
+        v = 1.0e9 + noise(rng);
+
+      ChannelStats stats;
+      for (std::size_t i = 0; i < values.size(); ++i)
+        stats.Add(values[i], i);
+
+      // Reference two-pass in long double; a plain double sum of 1e14
+      // is only good to about 1e-2.
+      long double sum = 0.0L;
+      for (double v : values)
+        sum += v;
+      const long double mean = sum / static_cast<long double>(values.size());
+      long double m2 = 0.0L;
+      for (double v : values)
+        m2 += (v - mean) * (v - mean);
+      const double variance =
+          static_cast<double>(m2 / static_cast<long double>(values.size() - 1));
+
+      GCS_EXPECT_EQ(stats.GetCount(), values.size());
+      // Each update rounds at the ulp of 1e9, so compare the mean relatively.
+      GCS_EXPECT_NEAR(stats.GetMean(), mean, 1e-13 * 1.0e9);
+      GCS_EXPECT_NEAR(stats.GetVariance(), variance, 1e-6 * variance);
+      GCS_EXPECT_NEAR(stats.GetStdDev(), std::sqrt(variance), 1e-6);
+    }
+
+    GCS_TEST(TelemetryStatsTest, MergeOfSegmentsMatchesSinglePass)
+    {
+      std::mt19937_64 rng(2);
+      std::uniform_real_distribution<double> value(-50.0, 50.0);
+      ChannelStats whole;
+      ChannelStats parts[3];
+      for (std::uint64_t i = 0; i < 30000; ++i)
+      {
+        const double v = value(rng);
+        whole.Add(v, i);
+        parts[i * 3 / 30000].Add(v, i);
+      }
+
+      ChannelStats merged;
+      for (const ChannelStats &part : parts)
+        merged.Merge(part);
+      GCS_EXPECT_EQ(merged.GetCount(), whole.GetCount());
+      GCS_EXPECT_NEAR(merged.GetMean(), whole.GetMean(), 1e-12);
+      GCS_EXPECT_NEAR(merged.GetVariance(), whole.GetVariance(), 1e-9);
+      GCS_EXPECT_EQ(merged.GetMin(), whole.GetMin());
+      GCS_EXPECT_EQ(merged.GetMaxTimestamp(), whole.GetMaxTimestamp());
+    }
+
+    GCS_TEST(TelemetryStatsTest, ExtremesKeepEarliestTimestampAndSkipNan)
+    {
+      ChannelStats stats;
+      GCS_EXPECT_TRUE(std::isnan(stats.GetMean()));
+      stats.Add(3.0, 10);
+      stats.Add(std::numeric_limits<double>::quiet_NaN(), 20);
+      stats.Add(-1.0, 30);
+      stats.Add(3.0, 40);
+      stats.Add(-1.0, 50);
+
+      GCS_EXPECT_EQ(stats.GetCount(), 4u);
+      GCS_EXPECT_EQ(stats.GetMax(), 3.0);
+      GCS_EXPECT_EQ(stats.GetMaxTimestamp(), 10u);
+      GCS_EXPECT_EQ(stats.GetMin(), -1.0);
+      GCS_EXPECT_EQ(stats.GetMinTimestamp(), 30u);
+      GCS_EXPECT_NEAR(stats.GetMean(), 1.0, 1e-12);
+    }
+
+    GCS_TEST(TelemetryStatsTest, TDigestQuantilesStayWithinRankBound)
+    {
+      std::mt19937_64 rng(3);
+      std::lognormal_distribution<double> skewed(0.0, 1.0);
+      std::vector<double> values(200000);
+      TDigest digest;
+      for (double &v : values)
+      {
+        v = skewed(rng);
+        digest.Add(v);
+      }
+      std::sort(values.begin(), values.end());
+
+      GCS_EXPECT_EQ(digest.Quantile(0.0), values.front());
+      GCS_EXPECT_EQ(digest.Quantile(1.0), values.back());
+
+      // Rank error: tight at the tails, looser in the middle where
+      // centroids are large.
+      for (double q : {0.001, 0.01, 0.05, 0.25, 0.5, 0.75, 0.95, 0.99, 0.999})
+      {
+        const double bound = std::min(q, 1.0 - q) < 0.05 ? 0.002 : 0.01;
+        GCS_EXPECT_NEAR(Rank(values, digest.Quantile(q)), q, bound);
+        GCS_EXPECT_NEAR(digest.Cdf(values[static_cast<std::size_t>(q * values.size())]),
+                        q, bound);
+      }
+    }
+
+    GCS_TEST(TelemetryStatsTest, MergedDigestsKeepRankBound)
+    {
+      std::mt19937_64 rng(4);
+      std::normal_distribution<double> normal(0.0, 1.0);
+      std::vector<double> values(100000);
+      TDigest parts[4];
+      for (std::size_t i = 0; i < values.size(); ++i)
+      {
+        values[i] = normal(rng);
+        parts[i % 4].Add(values[i]);
+      }
+      std::sort(values.begin(), values.end());
+
+      TDigest merged;
+      for (const TDigest &part : parts)
+        merged.Merge(part);
+      GCS_EXPECT_EQ(merged.GetCount(), values.size());
+      for (double q : {0.01, 0.5, 0.99})
+      {
+        GCS_EXPECT_NEAR(Rank(values, merged.Quantile(q)), q, 0.01);
+      }
+    }
+
+    GCS_TEST(TelemetryStatsTest, TelemetryStatsTracksDerivedChannels)
+    {
+      TelemetryStats stats;
+      TelemetryData frame;
+      frame.timestamp_us = 100;
+      frame.acc.data = {3.0, 4.0, 0.0};
+      frame.vel.data = {0.0, 6.0, 8.0};
+      stats.Add(frame);
+      frame.timestamp_us = 200;
+      frame.acc.data = {0.0, 0.0, 1.0};
+      stats.Add(frame);
+
+      GCS_EXPECT_EQ(stats.GetFrameCount(), 2u);
+      GCS_EXPECT_EQ(stats.GetFirstTimestamp(), 100u);
+      GCS_EXPECT_EQ(stats.GetLastTimestamp(), 200u);
+      GCS_EXPECT_EQ(stats.GetAccelerationNorm().GetMax(), 5.0);
+      GCS_EXPECT_EQ(stats.GetAccelerationNorm().GetMin(), 1.0);
+      GCS_EXPECT_EQ(stats.GetSpeed().GetMean(), 10.0);
+      GCS_EXPECT_EQ(stats.Get(TelemetryChannel::kAccX).GetMaxTimestamp(), 100u);
+    }
+
+  } // namespace
+} // namespace gcs::data
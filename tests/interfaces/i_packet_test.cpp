@@ -0,0 +1,144 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "interfaces/i_packet.h"
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "support/sample_protocol.h"
+#include "test_framework.h"
+
+namespace gcs::interfaces
+{
+  namespace
+  {
+    using testing::SamplePacket;
+
+    // Implements only the vector methods, as packets written before the
+    // span methods existed do.
+    class LegacyPacket : public IPacket
+    {
+    public:
+      std::vector<std::uint8_t> Serialize() const override
+      {
+        return {command, static_cast<std::uint8_t>(argument),
+                static_cast<std::uint8_t>(argument >> 8)};
+      }
+
+      void Deserialize(const std::vector<std::uint8_t> &data) override
+      {
+        if (data.size() != 3)
+          throw std::length_error("LegacyPacket needs 3 bytes");
+        command = data[0];
+        argument = static_cast<std::uint16_t>(data[1] | data[2] << 8);
+      }
+
+      int GetId() const override { return 0x10; }
+
+      std::uint8_t command = 0;
+      std::uint16_t argument = 0;
+    };
+
+    // Carries no payload.
+    class EmptyPacket : public IPacket
+    {
+    public:
+      std::size_t SerializedSize() const override { return 0; }
+      std::size_t SerializeTo(std::span<std::uint8_t>) const override
+      {
+        return 0;
+      }
+      bool DeserializeFrom(std::span<const std::uint8_t>) override
+      {
+        return true;
+      }
+      int GetId() const override { return 0x7E; }
+    };
+
+    SamplePacket MakeSample()
+    {
+      SamplePacket packet;
+      packet.uptime_ms = 123456;
+      packet.altitude = 321.5f;
+      packet.velocity = -4.25f;
+      return packet;
+    }
+
+    bool SameSample(const SamplePacket &a, const SamplePacket &b)
+    {
+      return a.uptime_ms == b.uptime_ms && a.altitude == b.altitude &&
+             a.velocity == b.velocity;
+    }
+
+    GCS_TEST(IPacketTest, SamplePacketRoundTripsThroughSpans)
+    {
+      const SamplePacket original = MakeSample();
+      std::array<std::uint8_t, 32> buffer{};
+      const std::size_t written = original.SerializeTo(buffer);
+      GCS_ASSERT_EQ(written, original.SerializedSize());
+
+      SamplePacket decoded;
+      GCS_EXPECT_TRUE(decoded.DeserializeFrom(std::span(buffer).first(written)));
+      GCS_EXPECT_TRUE(SameSample(decoded, original));
+    }
+
+    GCS_TEST(IPacketTest, SamplePacketRoundTripsThroughVectors)
+    {
+      const SamplePacket original = MakeSample();
+      const std::vector<std::uint8_t> bytes = original.Serialize();
+      GCS_ASSERT_EQ(bytes.size(), SamplePacket::kPayloadSize);
+
+      SamplePacket decoded;
+      decoded.Deserialize(bytes);
+      GCS_EXPECT_TRUE(SameSample(decoded, original));
+    }
+
+    GCS_TEST(IPacketTest, ShortDataIsRejected)
+    {
+      const SamplePacket original = MakeSample();
+      std::array<std::uint8_t, SamplePacket::kPayloadSize - 1> small{};
+      GCS_EXPECT_EQ(original.SerializeTo(small), 0u);
+
+      SamplePacket decoded;
+      GCS_EXPECT_FALSE(decoded.DeserializeFrom(small));
+      GCS_EXPECT_THROW(decoded.Deserialize(std::vector<std::uint8_t>(3)),
+                       std::invalid_argument);
+    }
+
+    GCS_TEST(IPacketTest, LegacyPacketGetsSpanMethods)
+    {
+      LegacyPacket original;
+      original.command = 7;
+      original.argument = 0xBEEF;
+      GCS_EXPECT_EQ(original.SerializedSize(), 3u);
+
+      std::array<std::uint8_t, 8> buffer{};
+      const std::size_t written = original.SerializeTo(buffer);
+      GCS_ASSERT_EQ(written, 3u);
+      GCS_EXPECT_EQ(original.SerializeTo(std::span(buffer).first(2)), 0u);
+
+      LegacyPacket decoded;
+      GCS_EXPECT_TRUE(decoded.DeserializeFrom(std::span(buffer).first(written)));
+      GCS_EXPECT_EQ(decoded.command, 7);
+      GCS_EXPECT_EQ(decoded.argument, 0xBEEF);
+
+      // A throwing Deserialize turns into a rejected DeserializeFrom.
+      GCS_EXPECT_FALSE(decoded.DeserializeFrom(buffer));
+    }
+
+    GCS_TEST(IPacketTest, EmptyPacketRoundTrips)
+    {
+      EmptyPacket original;
+      GCS_EXPECT_TRUE(original.Serialize().empty());
+
+      EmptyPacket decoded;
+      decoded.Deserialize({});
+      GCS_EXPECT_TRUE(decoded.DeserializeFrom({}));
+    }
+
+  } // namespace
+} // namespace gcs::interfaces
@@ -0,0 +1,127 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "interfaces/packet_dispatcher.h"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "test_framework.h"
+
+namespace gcs::interfaces
+{
+  namespace
+  {
+    // Payload-free packet reporting a fixed ID.
+    template <int Id>
+    class TestPacket : public IPacket
+    {
+    public:
+      static constexpr int kId = Id;
+
+      std::size_t SerializedSize() const override { return 0; }
+      std::size_t SerializeTo(std::span<std::uint8_t>) const override
+      {
+        return 0;
+      }
+      bool DeserializeFrom(std::span<const std::uint8_t>) override
+      {
+        return true;
+      }
+      int GetId() const override { return kId; }
+    };
+
+    // IDs 210 and 212 only, leaving a hole at 211.
+    using LowPacket = TestPacket<210>;
+    using HighPacket = TestPacket<212>;
+    using Packets = PacketDispatcher<PacketEntry<210, LowPacket>,
+                                     PacketEntry<212, HighPacket>>;
+
+    // Records which overload each packet reached.
+    struct Recorder
+    {
+      void operator()(const LowPacket &) { seen.push_back(LowPacket::kId); }
+      void operator()(const HighPacket &) { seen.push_back(HighPacket::kId); }
+
+      std::vector<int> seen;
+    };
+
+    GCS_TEST(PacketDispatcherTest, CallsOverloadOfConcreteType)
+    {
+      Recorder recorder;
+      GCS_EXPECT_TRUE(Packets::Dispatch(HighPacket{}, recorder));
+      GCS_EXPECT_TRUE(Packets::Dispatch(LowPacket{}, recorder));
+      GCS_EXPECT_EQ(recorder.seen, (std::vector<int>{212, 210}));
+    }
+
+    GCS_TEST(PacketDispatcherTest, UnknownIdsAreNotDispatched)
+    {
+      Recorder recorder;
+      GCS_EXPECT_FALSE(Packets::Dispatch(TestPacket<211>{}, recorder)); // Hole.
+      GCS_EXPECT_FALSE(Packets::Dispatch(TestPacket<213>{}, recorder)); // Past end.
+      GCS_EXPECT_FALSE(Packets::Dispatch(TestPacket<-1>{}, recorder));
+      GCS_EXPECT_FALSE(Packets::Dispatch(TestPacket<0>{}, recorder));
+      GCS_EXPECT_TRUE(recorder.seen.empty());
+    }
+
+    GCS_TEST(PacketDispatcherTest, DispatchKeepsArrivalOrder)
+    {
+      std::vector<std::shared_ptr<IPacket>> stream;
+      const int ids[] = {210, 212, 212, 211, 210, 212, 210};
+      std::vector<int> expected;
+      for (int id : ids)
+      {
+        if (id == 210)
+          stream.push_back(std::make_shared<LowPacket>());
+        else if (id == 212)
+          stream.push_back(std::make_shared<HighPacket>());
+        else
+          stream.push_back(std::make_shared<TestPacket<211>>());
+        if (id != 211)
+          expected.push_back(id);
+      }
+
+      Recorder recorder;
+      for (const auto &packet : stream)
+      {
+        Packets::Dispatch(*packet, recorder);
+      }
+      GCS_EXPECT_EQ(recorder.seen, expected);
+    }
+
+    GCS_TEST(PacketDispatcherTest, VisitorsOfDifferentTypesShareEntries)
+    {
+      int generic_calls = 0;
+      Packets::Dispatch(LowPacket{}, [&generic_calls](const auto &typed)
+                        { generic_calls += typed.GetId(); });
+      Recorder recorder;
+      Packets::Dispatch(LowPacket{}, recorder);
+      GCS_EXPECT_EQ(generic_calls, 210);
+      GCS_EXPECT_EQ(recorder.seen, (std::vector<int>{210}));
+    }
+
+    GCS_TEST(PacketDispatcherTest, ReRegisteringIdsKeepsDispatchUnchanged)
+    {
+      // A static list cannot list an ID twice; PacketIdTable rejects it.
+      static_assert(detail::HasDuplicatePacketIds(std::array<int, 3>{210, 212, 210}));
+      static_assert(!detail::HasDuplicatePacketIds(std::array<int, 2>{210, 212}));
+
+      // Registering the same entries with the runtime factory again, or a
+      // different type under a listed ID, does not change the dispatch table.
+      using Registry = StaticPacketRegistry<PacketEntry<210, LowPacket>,
+                                            PacketEntry<212, HighPacket>>;
+      Registry::RegisterAll();
+      Registry::RegisterAll();
+      PacketFactory::Register<HighPacket>(210);
+
+      std::shared_ptr<IPacket> packet = PacketFactory::Create(210);
+      GCS_ASSERT_TRUE(packet != nullptr);
+      Recorder recorder;
+      GCS_EXPECT_TRUE(Packets::Dispatch(*packet, recorder));
+      GCS_EXPECT_EQ(recorder.seen, (std::vector<int>{210}));
+    }
+
+  } // namespace
+} // namespace gcs::interfaces
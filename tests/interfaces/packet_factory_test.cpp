@@ -0,0 +1,87 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "interfaces/packet_factory.h"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include "support/sample_protocol.h"
+#include "test_framework.h"
+
+namespace gcs::interfaces
+{
+  namespace
+  {
+    using testing::SamplePacket;
+
+    // A second packet type, told apart from SamplePacket by its ID.
+    class EmptyPacket : public IPacket
+    {
+    public:
+      static constexpr int kId = 0x7E;
+
+      std::size_t SerializedSize() const override { return 0; }
+      std::size_t SerializeTo(std::span<std::uint8_t>) const override
+      {
+        return 0;
+      }
+      bool DeserializeFrom(std::span<const std::uint8_t>) override
+      {
+        return true;
+      }
+      int GetId() const override { return kId; }
+    };
+
+    // Each test uses its own IDs; the registry is process-wide.
+    GCS_TEST(PacketFactoryTest, DuplicateDenseIdKeepsFirst)
+    {
+      constexpr int kId = 200;
+      GCS_EXPECT_TRUE(PacketFactory::Register<SamplePacket>(kId));
+      GCS_EXPECT_FALSE(PacketFactory::Register<EmptyPacket>(kId));
+
+      std::shared_ptr<IPacket> packet = PacketFactory::Create(kId);
+      GCS_ASSERT_TRUE(packet != nullptr);
+      GCS_EXPECT_EQ(packet->GetId(), SamplePacket::kId);
+    }
+
+    GCS_TEST(PacketFactoryTest, DuplicateSparseIdKeepsFirst)
+    {
+      constexpr int kId = 100000;
+      GCS_EXPECT_TRUE(PacketFactory::Register<EmptyPacket>(kId));
+      GCS_EXPECT_FALSE(PacketFactory::Register<SamplePacket>(kId));
+
+      std::shared_ptr<IPacket> packet = PacketFactory::Create(kId);
+      GCS_ASSERT_TRUE(packet != nullptr);
+      GCS_EXPECT_EQ(packet->GetId(), EmptyPacket::kId);
+    }
+
+    GCS_TEST(PacketFactoryTest, SameTypeRegistersTwice)
+    {
+      constexpr int kId = 201;
+      GCS_EXPECT_TRUE(PacketFactory::Register<SamplePacket>(kId));
+      GCS_EXPECT_TRUE(PacketFactory::Register<SamplePacket>(kId));
+      GCS_EXPECT_TRUE(PacketFactory::IsRegistered(kId));
+    }
+
+    GCS_TEST(PacketFactoryTest, UnknownIdCreatesNothing)
+    {
+      GCS_EXPECT_FALSE(PacketFactory::IsRegistered(202));
+      GCS_EXPECT_TRUE(PacketFactory::Create(202) == nullptr);
+      GCS_EXPECT_TRUE(PacketFactory::Create(-5) == nullptr);
+    }
+
+    GCS_TEST(PacketFactoryTest, StaticRegistryFillsFactory)
+    {
+      using Packets = StaticPacketRegistry<PacketEntry<203, SamplePacket>,
+                                           PacketEntry<204, EmptyPacket>>;
+      static_assert(Packets::Contains(204) && !Packets::Contains(205));
+      Packets::RegisterAll();
+      GCS_EXPECT_EQ(PacketFactory::Create(204)->GetId(), EmptyPacket::kId);
+      GCS_EXPECT_EQ(Packets::Create(203)->GetId(), SamplePacket::kId);
+    }
+
+  } // namespace
+} // namespace gcs::interfaces
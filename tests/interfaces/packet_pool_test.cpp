@@ -0,0 +1,82 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "interfaces/packet_pool.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "alloc_counter.h"
+#include "support/sample_protocol.h"
+#include "test_framework.h"
+
+namespace gcs::interfaces
+{
+  namespace
+  {
+    using testing::AllocationScope;
+    using testing::SamplePacket;
+
+    GCS_TEST(PacketPoolTest, SteadyStateDoesNotAllocate)
+    {
+      // Warm the pool up to the peak number of packets in flight.
+      {
+        std::vector<std::shared_ptr<SamplePacket>> warm;
+        for (int i = 0; i < 4; ++i)
+        {
+          warm.push_back(PacketPool<SamplePacket>::Make());
+        }
+      }
+
+      AllocationScope scope;
+      for (int i = 0; i < 1000; ++i)
+      {
+        std::shared_ptr<IPacket> packet = PacketPool<SamplePacket>::Make();
+        std::shared_ptr<IPacket> listener_copy = packet;
+        GCS_EXPECT_EQ(listener_copy->GetId(), SamplePacket::kId);
+      }
+      GCS_EXPECT_EQ(scope.GetCount(), 0u);
+    }
+
+    GCS_TEST(PacketPoolTest, PacketsAreFreshlyConstructed)
+    {
+      auto first = PacketPool<SamplePacket>::Make();
+      first->altitude = 42.0f;
+      first.reset();
+
+      auto second = PacketPool<SamplePacket>::Make();
+      GCS_EXPECT_EQ(second->altitude, 0.0f);
+    }
+
+    GCS_TEST(PacketPoolTest, ConcurrentMakeStaysWithinPeak)
+    {
+      auto &pool = PacketPool<SamplePacket>::GetPool();
+      auto before = pool.GetHeapAllocationCount();
+
+      constexpr int kThreads = 4;
+      constexpr int kInFlight = 8;
+      std::vector<std::thread> threads;
+      for (int t = 0; t < kThreads; ++t)
+      {
+        threads.emplace_back([]()
+                             {
+                               std::vector<std::shared_ptr<SamplePacket>> live;
+                               for (int i = 0; i < 2000; ++i)
+                               {
+                                 live.push_back(PacketPool<SamplePacket>::Make());
+                                 if (live.size() == kInFlight)
+                                   live.clear();
+                               } });
+      }
+      for (auto &thread : threads)
+      {
+        thread.join();
+      }
+      GCS_EXPECT_LE(pool.GetHeapAllocationCount() - before,
+                    static_cast<std::uint64_t>(kThreads * kInFlight));
+    }
+
+  } // namespace
+} // namespace gcs::interfaces
@@ -0,0 +1,118 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "logging/log_pyramid.h"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "common/executor.h"
+#include "logging/parsed_log_format.h"
+#include "test_framework.h"
+
+namespace gcs::logging
+{
+  namespace
+  {
+    using data::TelemetryData;
+
+    constexpr std::size_t kFrameCount = 200;
+
+    // Writes a legacy parsed log and returns its path.
+    std::string WriteLegacyLog(const char *name)
+    {
+      const std::filesystem::path path =
+          std::filesystem::temp_directory_path() / name;
+      std::ofstream file(path, std::ios::binary | std::ios::trunc);
+      for (std::size_t i = 0; i < kFrameCount; ++i)
+      {
+        LegacyTelemetryData legacy;
+        legacy.timestamp = static_cast<std::uint32_t>(i * 10);
+        legacy.pos.z() = static_cast<double>(i);
+        file.write(reinterpret_cast<const char *>(&legacy), sizeof(legacy));
+      }
+      return path.string();
+    }
+
+    // Writes a sidecar with the given leaf size over the first frames.
+    void WriteSidecar(const std::string &log_path, std::uint32_t leaf_shift,
+                      std::size_t frames)
+    {
+      std::vector<TelemetryData> data(frames);
+      for (std::size_t i = 0; i < frames; ++i)
+      {
+        data[i].timestamp_us = i * 10000;
+        data[i].pos.z() = static_cast<double>(i);
+      }
+
+      LogPyramidBuilder builder(leaf_shift);
+      builder.Append(data);
+      std::vector<std::uint8_t> header = builder.WriteHeader();
+      std::span<const std::uint8_t> records = builder.GetOutput();
+      std::ofstream out(GetLogPyramidPath(log_path),
+                        std::ios::binary | std::ios::trunc);
+      out.write(reinterpret_cast<const char *>(header.data()), header.size());
+      out.write(reinterpret_cast<const char *>(records.data()), records.size());
+    }
+
+    std::size_t BuildAndGetLeafFrames(const std::string &log_path)
+    {
+      common::ManualExecutor executor;
+      bool result = false;
+      BuildLogPyramidAsync(log_path, executor, [&result](bool ok)
+                           { result = ok; });
+      executor.RunPending();
+      GCS_EXPECT_TRUE(result);
+
+      LogPyramid pyramid;
+      if (!pyramid.Open(GetLogPyramidPath(log_path)))
+        return 0;
+      GCS_EXPECT_EQ(pyramid.GetLeafCount() * pyramid.GetLeafFrames(),
+                    kFrameCount / pyramid.GetLeafFrames() *
+                        pyramid.GetLeafFrames());
+      return pyramid.GetLeafFrames();
+    }
+
+    void RemoveLog(const std::string &log_path)
+    {
+      std::filesystem::remove(GetLogPyramidPath(log_path));
+      std::filesystem::remove(log_path);
+    }
+
+    GCS_TEST(LogPyramidTest, CurrentSidecarWithOtherLeafSizeIsKept)
+    {
+      const std::string log = WriteLegacyLog("gcs_pyramid_other_leaf.dat");
+      // 8-frame leaves, while this build writes 1 << kLogPyramidLeafShift.
+      WriteSidecar(log, 3, kFrameCount);
+
+      GCS_EXPECT_EQ(BuildAndGetLeafFrames(log), 8u);
+      RemoveLog(log);
+    }
+
+    GCS_TEST(LogPyramidTest, StaleSidecarIsRebuilt)
+    {
+      const std::string log = WriteLegacyLog("gcs_pyramid_stale.dat");
+      WriteSidecar(log, 3, kFrameCount / 2);
+
+      GCS_EXPECT_EQ(BuildAndGetLeafFrames(log),
+                    std::size_t{1} << common::kLogPyramidLeafShift);
+      RemoveLog(log);
+    }
+
+    GCS_TEST(LogPyramidTest, MissingSidecarIsBuilt)
+    {
+      const std::string log = WriteLegacyLog("gcs_pyramid_missing.dat");
+      std::filesystem::remove(GetLogPyramidPath(log));
+
+      GCS_EXPECT_EQ(BuildAndGetLeafFrames(log),
+                    std::size_t{1} << common::kLogPyramidLeafShift);
+      RemoveLog(log);
+    }
+
+  } // namespace
+} // namespace gcs::logging
@@ -0,0 +1,205 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include "logging/parsed_log_format.h"
+
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <mutex>
+#include <vector>
+
+#include "interfaces/i_converter.h"
+#include "interfaces/i_parser.h"
+#include "logging/log_player.h"
+#include "test_framework.h"
+
+namespace gcs::logging
+{
+  namespace
+  {
+    using data::TelemetryData;
+    using data::TimestampUnwrapper;
+
+    // Ten frames 10 ms apart whose 32-bit millisecond clock wraps after the
+    // fifth.
+    constexpr std::uint32_t kFirstMs = 0xFFFFFFFFu - 45;
+    constexpr std::size_t kFrameCount = 10;
+
+    template <typename T>
+    void StoreLE(std::uint8_t *out, T value)
+    {
+      for (std::size_t i = 0; i < sizeof(T); ++i)
+      {
+        out[i] = static_cast<std::uint8_t>(value >> (8 * i));
+      }
+    }
+
+    std::uint64_t ExpectedUs(std::size_t i)
+    {
+      return (std::uint64_t{kFirstMs} + i * 10) * 1000;
+    }
+
+    std::vector<std::uint8_t> MakeLegacyRecords()
+    {
+      std::vector<std::uint8_t> bytes(kFrameCount * sizeof(LegacyTelemetryData));
+      for (std::size_t i = 0; i < kFrameCount; ++i)
+      {
+        LegacyTelemetryData legacy;
+        legacy.timestamp = static_cast<std::uint32_t>(kFirstMs + i * 10);
+        legacy.pos.x() = static_cast<double>(i);
+        std::memcpy(bytes.data() + i * sizeof(legacy), &legacy, sizeof(legacy));
+      }
+      return bytes;
+    }
+
+    // A version 1 file: a u32 millisecond timestamp and pos.x as f64.
+    std::vector<std::uint8_t> MakeVersion1Log()
+    {
+      constexpr std::size_t kFieldCount = 2;
+      constexpr std::size_t kRecordSize = 12;
+      constexpr std::size_t kHeaderSize =
+          ParsedLogSchema::kFixedHeaderSize +
+          kFieldCount * ParsedLogSchema::kFieldEntrySize;
+
+      std::vector<std::uint8_t> bytes(kHeaderSize + kFrameCount * kRecordSize);
+      std::memcpy(bytes.data(), kParsedLogMagic.data(), kParsedLogMagic.size());
+      std::uint8_t *out = bytes.data() + kParsedLogMagic.size();
+      StoreLE<std::uint16_t>(out, 1);
+      StoreLE<std::uint16_t>(out + 2, kHeaderSize);
+      StoreLE<std::uint16_t>(out + 4, kRecordSize);
+      StoreLE<std::uint16_t>(out + 6, kFieldCount);
+      out[8] = static_cast<std::uint8_t>(ParsedLogEncoding::kFloat64);
+
+      std::uint8_t *entry = bytes.data() + ParsedLogSchema::kFixedHeaderSize;
+      StoreLE(entry, static_cast<std::uint16_t>(ParsedFieldId::kTimestampMs));
+      entry[2] = static_cast<std::uint8_t>(ParsedFieldType::kU32);
+      StoreLE<std::uint32_t>(entry + 4, 0);
+      StoreLE(entry + 8, std::bit_cast<std::uint64_t>(1.0));
+      entry += ParsedLogSchema::kFieldEntrySize;
+      StoreLE(entry, static_cast<std::uint16_t>(ParsedFieldId::kFirstChannel));
+      entry[2] = static_cast<std::uint8_t>(ParsedFieldType::kF64);
+      StoreLE<std::uint32_t>(entry + 4, 4);
+      StoreLE(entry + 8, std::bit_cast<std::uint64_t>(1.0));
+
+      std::uint8_t *record = bytes.data() + kHeaderSize;
+      for (std::size_t i = 0; i < kFrameCount; ++i, record += kRecordSize)
+      {
+        StoreLE(record, static_cast<std::uint32_t>(kFirstMs + i * 10));
+        StoreLE(record + 4,
+                std::bit_cast<std::uint64_t>(static_cast<double>(i)));
+      }
+      return bytes;
+    }
+
+    GCS_TEST(ParsedLogFormatTest, LegacyTimestampsUnwrapAcrossCalls)
+    {
+      const std::vector<std::uint8_t> bytes = MakeLegacyRecords();
+      std::vector<TelemetryData> frames(kFrameCount);
+      TimestampUnwrapper unwrapper;
+
+      // Two batches, split before the wrap as a replay would read them.
+      const std::size_t split = 3 * sizeof(LegacyTelemetryData);
+      std::size_t count = DecodeLegacyRecords(
+          std::span(bytes).first(split), frames, unwrapper);
+      count += DecodeLegacyRecords(std::span(bytes).subspan(split),
+                                   std::span(frames).subspan(count), unwrapper);
+      GCS_ASSERT_EQ(count, kFrameCount);
+
+      for (std::size_t i = 0; i < kFrameCount; ++i)
+      {
+        GCS_EXPECT_EQ(frames[i].timestamp_us, ExpectedUs(i));
+        GCS_EXPECT_EQ(frames[i].pos.x(), static_cast<double>(i));
+      }
+    }
+
+    GCS_TEST(ParsedLogFormatTest, Version1TimestampsUnwrap)
+    {
+      const std::vector<std::uint8_t> bytes = MakeVersion1Log();
+      std::optional<ParsedLogSchema> schema = ParsedLogSchema::ReadHeader(bytes);
+      GCS_ASSERT_TRUE(schema.has_value());
+      GCS_EXPECT_EQ(schema->GetVersion(), 1);
+
+      std::vector<TelemetryData> frames(kFrameCount);
+      TimestampUnwrapper unwrapper;
+      std::size_t count = schema->DecodeRecords(
+          std::span(bytes).subspan(schema->GetHeaderSize()), frames, unwrapper);
+      GCS_ASSERT_EQ(count, kFrameCount);
+      for (std::size_t i = 0; i < kFrameCount; ++i)
+      {
+        GCS_EXPECT_EQ(frames[i].timestamp_us, ExpectedUs(i));
+        GCS_EXPECT_EQ(frames[i].pos.x(), static_cast<double>(i));
+      }
+    }
+
+    GCS_TEST(ParsedLogFormatTest, MicrosecondTimestampsAreNotUnwrapped)
+    {
+      ParsedLogSchema schema(ParsedLogEncoding::kFloat64);
+      const std::uint64_t timestamps[] = {std::uint64_t{1} << 40, 5, 0};
+      std::vector<std::uint8_t> bytes(3 * schema.GetRecordSize());
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+        TelemetryData frame;
+        frame.timestamp_us = timestamps[i];
+        schema.Encode(frame, std::span(bytes).subspan(
+                                 i * schema.GetRecordSize()));
+      }
+
+      std::vector<TelemetryData> frames(3);
+      TimestampUnwrapper unwrapper;
+      GCS_ASSERT_EQ(schema.DecodeRecords(bytes, frames, unwrapper), 3u);
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+        GCS_EXPECT_EQ(frames[i].timestamp_us, timestamps[i]);
+      }
+    }
+
+    GCS_TEST(ParsedLogFormatTest, LogPlayerUnwrapsLegacyLog)
+    {
+      const std::filesystem::path path =
+          std::filesystem::temp_directory_path() / "gcs_legacy_wrap_test.dat";
+      {
+        const std::vector<std::uint8_t> bytes = MakeLegacyRecords();
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+      }
+
+      std::mutex mutex;
+      std::vector<std::uint64_t> timestamps;
+      std::promise<void> eof;
+      {
+        LogPlayer player(nullptr, nullptr);
+        auto frames = player.OnTelemetry.ConnectBatch(
+            [&](std::span<const TelemetryData> batch)
+            {
+              std::lock_guard<std::mutex> lock(mutex);
+              for (const TelemetryData &frame : batch)
+                timestamps.push_back(frame.timestamp_us);
+            });
+        auto done = player.OnEof.Connect([&]()
+                                         { eof.set_value(); });
+
+        GCS_ASSERT_TRUE(player.Load(path.string(), LogType::kParsed));
+        player.SetSpeed(100.0);
+        player.Play();
+        GCS_EXPECT_TRUE(eof.get_future().wait_for(std::chrono::seconds(10)) ==
+                        std::future_status::ready);
+        player.Stop();
+      }
+      std::filesystem::remove(path);
+
+      std::lock_guard<std::mutex> lock(mutex);
+      GCS_ASSERT_EQ(timestamps.size(), kFrameCount);
+      for (std::size_t i = 0; i < kFrameCount; ++i)
+      {
+        GCS_EXPECT_EQ(timestamps[i], ExpectedUs(i));
+      }
+    }
+
+  } // namespace
+} // namespace gcs::logging
@@ -0,0 +1,201 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_TESTS_SUPPORT_SAMPLE_PROTOCOL_H_
+#define GCS_CORE_TESTS_SUPPORT_SAMPLE_PROTOCOL_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "data/telemetry.h"
+#include "data/timestamp_unwrapper.h"
+#include "interfaces/i_converter.h"
+#include "interfaces/i_packet.h"
+#include "interfaces/i_parser.h"
+#include "interfaces/packet_pool.h"
+
+/**
+ * @file sample_protocol.h
+ * @brief Small concrete protocol shared by the tests and benchmarks.
+ *
+ * A frame is a sync byte, a 12-byte payload (uptime in ms, altitude,
+ * velocity) and an XOR checksum of the payload. The parser and converter
+ * implement both the static stage interface used by StaticPipeline and the
+ * IParser/IConverter virtual interfaces, forwarding one to the other.
+ */
+
+namespace gcs::testing
+{
+
+  class SamplePacket : public interfaces::IPacket
+  {
+  public:
+    static constexpr int kId = 0x01;
+    static constexpr std::size_t kPayloadSize = 12;
+
+    std::size_t SerializedSize() const override { return kPayloadSize; }
+
+    std::size_t SerializeTo(std::span<std::uint8_t> buffer) const override
+    {
+      if (buffer.size() < kPayloadSize)
+        return 0;
+      std::memcpy(&buffer[0], &uptime_ms, 4);
+      std::memcpy(&buffer[4], &altitude, 4);
+      std::memcpy(&buffer[8], &velocity, 4);
+      return kPayloadSize;
+    }
+
+    bool DeserializeFrom(std::span<const std::uint8_t> data) override
+    {
+      if (data.size() < kPayloadSize)
+        return false;
+      std::memcpy(&uptime_ms, &data[0], 4);
+      std::memcpy(&altitude, &data[4], 4);
+      std::memcpy(&velocity, &data[8], 4);
+      return true;
+    }
+
+    int GetId() const override { return kId; }
+
+    std::uint32_t uptime_ms = 0;
+    float altitude = 0.0f;
+    float velocity = 0.0f;
+  };
+
+  constexpr std::uint8_t kSampleSync = 0xA5;
+  constexpr std::size_t kSampleFrameSize = SamplePacket::kPayloadSize + 2;
+
+  /**
+   * @brief Appends the wire frame of a packet to out.
+   */
+  inline void AppendSampleFrame(const SamplePacket &packet,
+                                std::vector<std::uint8_t> &out)
+  {
+    std::array<std::uint8_t, SamplePacket::kPayloadSize> payload{};
+    packet.SerializeTo(payload);
+    std::uint8_t checksum = 0;
+    out.push_back(kSampleSync);
+    for (std::uint8_t byte : payload)
+    {
+      out.push_back(byte);
+      checksum ^= byte;
+    }
+    out.push_back(checksum);
+  }
+
+  class SampleParser : public interfaces::IParser
+  {
+  public:
+    SampleParser() = default;
+    SampleParser(SampleParser &&other) noexcept
+        : frame_(other.frame_), fill_(other.fill_) {}
+
+    /**
+     * @brief Static stage: calls emit(const SamplePacket &) per valid frame.
+     */
+    template <typename Emit>
+    void Parse(std::span<const std::uint8_t> data, Emit &&emit)
+    {
+      for (std::uint8_t byte : data)
+      {
+        if (fill_ == 0 && byte != kSampleSync)
+          continue;
+
+        frame_[fill_++] = byte;
+        if (fill_ < kSampleFrameSize)
+          continue;
+
+        fill_ = 0;
+        std::uint8_t checksum = 0;
+        for (std::size_t i = 1; i <= SamplePacket::kPayloadSize; ++i)
+        {
+          checksum ^= frame_[i];
+        }
+        if (checksum == frame_[kSampleFrameSize - 1] &&
+            packet_.DeserializeFrom(
+                std::span(frame_).subspan(1, SamplePacket::kPayloadSize)))
+        {
+          emit(static_cast<const SamplePacket &>(packet_));
+        }
+      }
+    }
+
+    void PushData(std::span<const std::uint8_t> data) override
+    {
+      Parse(data, [this](const SamplePacket &parsed)
+            {
+              auto packet = interfaces::PacketPool<SamplePacket>::Make();
+              *packet = parsed;
+              OnPacketReceived.Invoke(std::shared_ptr<interfaces::IPacket>(std::move(packet))); });
+    }
+
+    void Reset() override { fill_ = 0; }
+
+  private:
+    std::array<std::uint8_t, kSampleFrameSize> frame_{};
+    std::size_t fill_ = 0;
+    SamplePacket packet_;
+  };
+
+  class SampleConverter : public interfaces::IConverter
+  {
+  public:
+    SampleConverter() = default;
+    SampleConverter(SampleConverter &&other) noexcept
+        : unwrapper_(other.unwrapper_) {}
+
+    /**
+     * @brief Static stage: calls emit(const TelemetryData &) per packet.
+     */
+    template <typename Emit>
+    void Convert(const SamplePacket &packet, Emit &&emit)
+    {
+      data::TelemetryData frame{};
+      frame.timestamp_us = unwrapper_.Unwrap(packet.uptime_ms) * 1000;
+      frame.pos.z() = packet.altitude;
+      frame.vel.z() = packet.velocity;
+      emit(static_cast<const data::TelemetryData &>(frame));
+    }
+
+    void Convert(const std::shared_ptr<interfaces::IPacket> &packet) override
+    {
+      if (!packet || packet->GetId() != SamplePacket::kId)
+        return;
+      Convert(static_cast<const SamplePacket &>(*packet),
+              [this](const data::TelemetryData &frame)
+              { OnTelemetryConverted.Invoke(frame); });
+    }
+
+    void Reset() override { unwrapper_.Reset(); }
+
+  private:
+    data::TimestampUnwrapper unwrapper_;
+  };
+
+  /**
+   * @brief Encodes count frames with increasing uptime and altitude.
+   */
+  inline std::vector<std::uint8_t> MakeSampleStream(std::size_t count)
+  {
+    std::vector<std::uint8_t> bytes;
+    bytes.reserve(count * kSampleFrameSize);
+    SamplePacket packet;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      packet.uptime_ms = static_cast<std::uint32_t>(i * 10);
+      packet.altitude = static_cast<float>(i);
+      packet.velocity = 1.0f;
+      AppendSampleFrame(packet, bytes);
+    }
+    return bytes;
+  }
+
+} // namespace gcs::testing
+
+#endif // GCS_CORE_TESTS_SUPPORT_SAMPLE_PROTOCOL_H_
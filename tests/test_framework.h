@@ -0,0 +1,98 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#ifndef GCS_CORE_TESTS_TEST_FRAMEWORK_H_
+#define GCS_CORE_TESTS_TEST_FRAMEWORK_H_
+
+#include <cmath>
+#include <cstdio>
+
+/**
+ * @file test_framework.h
+ * @brief Minimal self-registering test harness, so the tests build without
+ * third-party dependencies.
+ *
+ * GCS_EXPECT_* record a failure and continue; GCS_ASSERT_* also end the
+ * current test.
+ */
+
+namespace gcs::testing
+{
+
+  using TestFunction = void (*)();
+
+  /**
+   * @brief Adds a test to the global list run by test_main.cpp.
+   * @return Always true; used to register at static-initialization time.
+   */
+  bool RegisterTest(const char *name, TestFunction function);
+
+  /**
+   * @brief Records a failed check of the running test.
+   */
+  void ReportFailure(const char *file, int line, const char *expression);
+
+  /**
+   * @brief Thrown by GCS_ASSERT_* to end the running test.
+   */
+  struct AssertionAbort
+  {
+  };
+
+} // namespace gcs::testing
+
+#define GCS_TEST(suite, name)                                              \
+  static void suite##_##name##_Test();                                     \
+  [[maybe_unused]] static const bool suite##_##name##_registered =         \
+      ::gcs::testing::RegisterTest(#suite "." #name, &suite##_##name##_Test); \
+  static void suite##_##name##_Test()
+
+#define GCS_EXPECT_TRUE(condition)                                         \
+  do                                                                       \
+  {                                                                        \
+    if (!(condition))                                                      \
+      ::gcs::testing::ReportFailure(__FILE__, __LINE__, #condition);       \
+  } while (false)
+
+#define GCS_EXPECT_FALSE(condition) GCS_EXPECT_TRUE(!(condition))
+#define GCS_EXPECT_EQ(a, b) GCS_EXPECT_TRUE((a) == (b))
+#define GCS_EXPECT_NE(a, b) GCS_EXPECT_TRUE((a) != (b))
+#define GCS_EXPECT_LE(a, b) GCS_EXPECT_TRUE((a) <= (b))
+#define GCS_EXPECT_LT(a, b) GCS_EXPECT_TRUE((a) < (b))
+#define GCS_EXPECT_GE(a, b) GCS_EXPECT_TRUE((a) >= (b))
+#define GCS_EXPECT_GT(a, b) GCS_EXPECT_TRUE((a) > (b))
+#define GCS_EXPECT_NEAR(a, b, tolerance) \
+  GCS_EXPECT_TRUE(std::fabs(static_cast<double>(a) - static_cast<double>(b)) <= (tolerance))
+
+#define GCS_EXPECT_THROW(statement, exception)                             \
+  do                                                                       \
+  {                                                                        \
+    bool gcs_thrown = false;                                               \
+    try                                                                    \
+    {                                                                      \
+      statement;                                                           \
+    }                                                                      \
+    catch (const exception &)                                              \
+    {                                                                      \
+      gcs_thrown = true;                                                   \
+    }                                                                      \
+    if (!gcs_thrown)                                                       \
+      ::gcs::testing::ReportFailure(__FILE__, __LINE__,                    \
+                                    #statement " throws " #exception);     \
+  } while (false)
+
+#define GCS_ASSERT_TRUE(condition)                                         \
+  do                                                                       \
+  {                                                                        \
+    if (!(condition))                                                      \
+    {                                                                      \
+      ::gcs::testing::ReportFailure(__FILE__, __LINE__, #condition);       \
+      throw ::gcs::testing::AssertionAbort{};                              \
+    }                                                                      \
+  } while (false)
+
+#define GCS_ASSERT_FALSE(condition) GCS_ASSERT_TRUE(!(condition))
+#define GCS_ASSERT_EQ(a, b) GCS_ASSERT_TRUE((a) == (b))
+
+#endif // GCS_CORE_TESTS_TEST_FRAMEWORK_H_
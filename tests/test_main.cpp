@@ -0,0 +1,87 @@
+// Copyright 2026 윤원빈. All rights reserved.
+// Use of this source code is governed by a MIT-style license that can be
+// found in the LICENSE file.
+
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <vector>
+
+#include "test_framework.h"
+
+namespace gcs::testing
+{
+  namespace
+  {
+    struct TestCase
+    {
+      const char *name;
+      TestFunction function;
+    };
+
+    std::vector<TestCase> &GetTests()
+    {
+      static std::vector<TestCase> tests;
+      return tests;
+    }
+
+    int current_failures = 0;
+  } // namespace
+
+  bool RegisterTest(const char *name, TestFunction function)
+  {
+    GetTests().push_back({name, function});
+    return true;
+  }
+
+  void ReportFailure(const char *file, int line, const char *expression)
+  {
+    std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+    ++current_failures;
+  }
+
+} // namespace gcs::testing
+
+/**
+ * Runs every registered test, or only those whose name starts with argv[1].
+ */
+int main(int argc, char **argv)
+{
+  using namespace gcs::testing;
+
+  const char *filter = argc > 1 ? argv[1] : "";
+  int failed = 0;
+  int run = 0;
+  for (const TestCase &test : GetTests())
+  {
+    if (std::strncmp(test.name, filter, std::strlen(filter)) != 0)
+      continue;
+
+    current_failures = 0;
+    try
+    {
+      test.function();
+    }
+    catch (const AssertionAbort &)
+    {
+    }
+    catch (const std::exception &e)
+    {
+      ReportFailure(test.name, 0, e.what());
+    }
+
+    ++run;
+    if (current_failures != 0)
+    {
+      ++failed;
+      std::printf("[FAILED] %s\n", test.name);
+    }
+    else
+    {
+      std::printf("[  OK  ] %s\n", test.name);
+    }
+  }
+
+  std::printf("%d of %d tests passed\n", run - failed, run);
+  return failed == 0 && run > 0 ? 0 : 1;
+}